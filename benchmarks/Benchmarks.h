@@ -0,0 +1,107 @@
+#pragma once
+
+
+#include <Evo.h>
+
+#include "./Generate.h"
+#include "frontend/SourceManager.h"
+#include "LLVM_interface/llvm_protos.h"
+
+#include <chrono>
+
+namespace panther{
+	namespace bench{
+
+		// each benchmark returns the exit code (not 0 if the generated code failed to compile or a check failed)
+
+		// wall time of each frontend phase for each number of threads (1, 2, 4, ... up to `max_threads`)
+		EVO_NODISCARD auto threadScaling(evo::uint max_threads) noexcept -> int;
+
+		// time of semantic analysis for an increasing number of instances of a template struct
+		EVO_NODISCARD auto templateInstances() noexcept -> int;
+
+		// throughput of tokenizing the generated program on a single thread
+		EVO_NODISCARD auto tokenizer() noexcept -> int;
+
+		// checks that every alloca of the lowered LLVM IR is in the entry block of its function
+		EVO_NODISCARD auto entryAllocas() noexcept -> int;
+
+		// run time of generated code that mostly makes calls with read params of different sizes (O0)
+		EVO_NODISCARD auto calls() noexcept -> int;
+
+		// run time of the generated code of `calls()` at each optimization level
+		EVO_NODISCARD auto optLevels() noexcept -> int;
+
+		// run time of generated code that makes a 256 byte struct in each call and passes it to the next call (O0 and O2)
+		EVO_NODISCARD auto structs() noexcept -> int;
+
+
+
+		//////////////////////////////////////////////////////////////////////
+		// helpers
+
+		// wall time that `func` took in milliseconds
+		template<class Func>
+		EVO_NODISCARD auto timeMS(Func&& func) noexcept -> double {
+			const auto start = std::chrono::steady_clock::now();
+			func();
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		};
+
+
+		// every message is counted as a failure (the generated code should compile without warnings)
+		class MessageCounter{
+			public:
+				MessageCounter() = default;
+				~MessageCounter() = default;
+
+				EVO_NODISCARD auto getCallback() noexcept -> SourceManager::MessageCallback {
+					return [this](const Message& message) noexcept -> void {
+						if(this->num_messages == 0){
+							evo::print(std::format("Generated code failed to compile: {}\n", message.message));
+						}
+						this->num_messages += 1;
+					};
+				};
+
+				EVO_NODISCARD inline auto getNumMessages() const noexcept -> uint32_t { return this->num_messages; };
+
+			private:
+				uint32_t num_messages = 0;
+		};
+
+
+		struct ProgramRun{
+			uint64_t returnCode;
+			double timeMS; // includes compiling the functions (the JIT compiles each function the first time it's called)
+		};
+
+		// compiles the sources with `opt_level` and runs the entry function in the JIT
+		// returns nullopt if the generated code failed to compile
+		EVO_NODISCARD auto runProgram(const std::vector<GeneratedSource>& sources, llvmint::OptLevel opt_level) noexcept
+			-> std::optional<ProgramRun>;
+
+		// fastest of `num_runs` run times of the program of `generateCalls()`, without the time of compiling the functions
+		// 	(the time of the same program with a depth of 0 is subtracted)
+		// returns nullopt if the generated code failed to compile or didn't return the number of calls
+		EVO_NODISCARD auto timeCalls(
+			uint32_t depth, uint32_t num_struct_members, bool make_structs, llvmint::OptLevel opt_level, uint32_t num_runs
+		) noexcept -> std::optional<double>;
+
+
+		// adds the sources and locks the source manager
+		inline auto addSources(SourceManager& source_manager, const std::vector<GeneratedSource>& sources) noexcept -> void {
+			static const auto source_config = Source::Config{.allowStructMemberTypeInference = true};
+
+			for(const GeneratedSource& source : sources){
+				std::ignore = source_manager.addSource(
+					std::filesystem::path(source_manager.getConfig().basePath) / source.path, std::string(source.code), source_config
+				);
+			}
+
+			source_manager.lock();
+		};
+
+
+	};
+};
@@ -0,0 +1,37 @@
+#include "./Benchmarks.h"
+
+
+namespace panther{
+	namespace bench{
+
+		static constexpr uint32_t DEPTH = 32;
+
+		// 1 and 2 fit in 2 registers (on 64 bit targets), so they're passed by value
+		static constexpr auto NUM_STRUCT_MEMBERS = std::to_array<uint32_t>({1, 2, 4});
+
+		// the fastest run is reported
+		static constexpr uint32_t NUM_RUNS = 3;
+
+
+		auto calls() noexcept -> int {
+			const uint64_t num_calls = numCalls(DEPTH);
+
+			evo::print(std::format("Calls with read params (O0, {} calls, fastest of {} runs)\n", num_calls, NUM_RUNS));
+			evo::print("struct size | run time (ms) | ns per call\n");
+
+			for(uint32_t num_struct_members : NUM_STRUCT_MEMBERS){
+				const std::optional<double> run_time = timeCalls(DEPTH, num_struct_members, false, llvmint::OptLevel::O0, NUM_RUNS);
+				if(run_time.has_value() == false){ return 1; }
+
+				evo::print(std::format(
+					"{:>5} bytes | {:>13.1f} | {:>11.2f}\n",
+					num_struct_members * sizeof(uint64_t), *run_time, *run_time * 1e6 / double(num_calls)
+				));
+			}
+
+			return 0;
+		};
+
+
+	};
+};
@@ -0,0 +1,209 @@
+#include "./Benchmarks.h"
+
+#include "PIRToLLVMIR.h"
+
+
+namespace panther{
+	namespace bench{
+
+		// conditionals nested in conditionals with variables, struct initializers, and calls that return structs (sret)
+		// 	declared inside of them
+		static constexpr std::string_view NESTED_CONDITIONALS_CODE = R"(
+struct Small = {
+	var a: Int = 1;
+	var b: Int = 2;
+}
+
+struct Big = {
+	var a: Int = 1;
+	var b: Int = 2;
+	var c: Int = 3;
+	var inner: Small = Small{a = 4, b = 5};
+}
+
+func make_big = (n: Int read) -> Big {
+	if(n < 0){
+		var neg = Big{a = n};
+		return neg;
+	}
+	return Big{a = n, c = n + 1};
+}
+
+func sum = (b: Big read) -> Int {
+	return b.a + b.b + b.c + b.inner.a + b.inner.b;
+}
+
+func add_to = (x: Int write, y: Int read) -> Void {
+	x = x + y;
+}
+
+func nested = (n: Int read) -> Int {
+	var total: Int = 0;
+	if(n < 10){
+		var small = Small{a = n};
+		if(n < 5){
+			var big = make_big(n);
+			add_to(total, sum(big) + sum(make_big(small.a)));
+		}else{
+			var big = Big{inner = Small{b = small.a}};
+			add_to(total, sum(big));
+		}
+	}else{
+		add_to(total, make_big(n).c);
+	}
+	return total;
+}
+
+func entry = () #entry -> Int {
+	return nested(1) + nested(7) + nested(20);
+}
+)";
+
+
+		// of the allocas outside of the entry block of each program
+		static constexpr size_t MAX_PRINTED_ALLOCAS = 5;
+
+
+		struct AllocaCounts{
+			uint32_t num_funcs = 0;
+			uint32_t in_entry_block = 0;
+			std::vector<std::string> outside_entry_block{}; // the line of each alloca
+		};
+
+		// counts the allocas of each function in the printed LLVM IR
+		// 	(in a function body every line that doesn't start with whitespace, other than the closing brace, is a block label)
+		static auto count_allocas(std::string_view llvm_ir) noexcept -> AllocaCounts {
+			auto alloca_counts = AllocaCounts();
+
+			bool in_func = false;
+			bool in_entry_block = false;
+			bool is_func_start = false; // the label of the entry block (if it has one) is the first line of the function
+
+			while(llvm_ir.empty() == false){
+				const size_t line_end = std::min(llvm_ir.find('\n'), llvm_ir.size());
+				const std::string_view line = llvm_ir.substr(0, line_end);
+				llvm_ir.remove_prefix(std::min(line_end + 1, llvm_ir.size()));
+
+				if(in_func == false){
+					if(line.starts_with("define ")){
+						in_func = true;
+						in_entry_block = true;
+						is_func_start = true;
+						alloca_counts.num_funcs += 1;
+					}
+					continue;
+				}
+
+				if(line.starts_with("}")){
+					in_func = false;
+
+				}else if(line.empty() == false && line[0] != ' ' && line[0] != '\t'){
+					if(is_func_start == false){ in_entry_block = false; }
+
+				}else if(line.find(" = alloca ") != std::string_view::npos){
+					if(in_entry_block){
+						alloca_counts.in_entry_block += 1;
+					}else{
+						alloca_counts.outside_entry_block.emplace_back(line);
+					}
+				}
+
+				is_func_start = false;
+			}
+
+			return alloca_counts;
+		};
+
+
+		// lowers the sources (without optimizing) and returns the printed LLVM IR
+		static auto lower_to_llvmir(const std::vector<GeneratedSource>& sources) noexcept -> std::optional<std::string> {
+			auto message_counter = MessageCounter();
+			auto source_manager = SourceManager(SourceManager::Config{.basePath = "bench"}, message_counter.getCallback());
+			addSources(source_manager, sources);
+
+			if(source_manager.tokenize() > 0 || source_manager.parse() > 0){ return std::nullopt; }
+
+			source_manager.initBuiltinTypes();
+			source_manager.initIntrinsics();
+			if(source_manager.semanticAnalysis() > 0 || message_counter.getNumMessages() > 0){ return std::nullopt; }
+
+
+			auto llvm_context = llvmint::Context();
+			llvm_context.init();
+
+			auto pir_to_llvmir = PIRToLLVMIR();
+			const std::string init_err = pir_to_llvmir.init(
+				"entry_allocas", llvm_context, "", llvmint::TargetConfig(), llvmint::OptLevel::O0
+			);
+			if(init_err.empty() == false){
+				evo::print(std::format("Failed to set target: {}\n", init_err));
+				pir_to_llvmir.shutdown();
+				llvm_context.shutdown();
+				return std::nullopt;
+			}
+
+			pir_to_llvmir.initLibC();
+			pir_to_llvmir.lower(source_manager);
+			if(source_manager.hasEntry()){
+				pir_to_llvmir.addRuntime(source_manager.getEntry());
+			}
+
+			std::string llvm_ir = pir_to_llvmir.printLLVMIR();
+
+			pir_to_llvmir.shutdown();
+			llvm_context.shutdown();
+
+			return llvm_ir;
+		};
+
+
+
+		auto entryAllocas() noexcept -> int {
+			struct Program{
+				std::string_view name;
+				std::vector<GeneratedSource> sources;
+			};
+
+			const auto programs = std::to_array<Program>({
+				Program("nested conditionals", {GeneratedSource("nested.pthr", std::string(NESTED_CONDITIONALS_CODE))}),
+				Program("generated program", generateProgram(4, 20)),
+				Program("template instances", {generateTemplateInstances(20)}),
+			});
+
+			evo::print("Allocas in the LLVM IR (before optimizing)\n");
+			evo::print("program              | funcs | in entry block | outside entry block\n");
+
+			bool all_in_entry_block = true;
+
+			for(const Program& program : programs){
+				const std::optional<std::string> llvm_ir = lower_to_llvmir(program.sources);
+				if(llvm_ir.has_value() == false){ return 1; }
+
+				const AllocaCounts alloca_counts = count_allocas(*llvm_ir);
+
+				evo::print(std::format(
+					"{:<20} | {:>5} | {:>14} | {:>19}\n",
+					program.name,
+					alloca_counts.num_funcs,
+					alloca_counts.in_entry_block,
+					alloca_counts.outside_entry_block.size()
+				));
+
+				for(size_t i = 0; i < std::min(alloca_counts.outside_entry_block.size(), MAX_PRINTED_ALLOCAS); i+=1){
+					evo::print(std::format("\t{}\n", alloca_counts.outside_entry_block[i]));
+				}
+
+				if(alloca_counts.outside_entry_block.empty() == false){ all_in_entry_block = false; }
+			}
+
+			if(all_in_entry_block == false){
+				evo::print("FAILED: found allocas outside of the entry block\n");
+				return 1;
+			}
+
+			return 0;
+		};
+
+
+	};
+};
@@ -0,0 +1,117 @@
+#include "./Generate.h"
+
+#include <utility>
+
+
+namespace panther{
+	namespace bench{
+
+
+		auto generateProgram(uint32_t num_sources, uint32_t funcs_per_source) noexcept -> std::vector<GeneratedSource> {
+			evo::debugAssert(funcs_per_source > 0, "Each source must have at least 1 function");
+
+			auto sources = std::vector<GeneratedSource>();
+			sources.reserve(num_sources);
+
+			for(uint32_t i = 0; i < num_sources; i+=1){
+				auto code = std::string();
+
+				if(i > 0){
+					code += std::format("def dep = @import(\"f{}.pthr\");\n\n", i - 1);
+				}
+
+				code += std::format("var g{} #pub: Int = {};\n\n", i, i);
+				code += std::format("struct Pair{} = #pub {{\n\tvar x: Int = 0;\n\tvar y: Int = 1;\n}}\n\n", i);
+				code += std::format("struct Templ{} = <{{T: Type, DEFAULT: T}}> #pub {{\n\tvar v: T = DEFAULT;\n}}\n\n", i);
+
+				for(uint32_t f = 0; f < funcs_per_source; f+=1){
+					code += std::format("func fn{}_{} = (x: Int read, p: Pair{} read, out: Int write) #pub -> Int {{\n", i, f, i);
+					code += std::format("\tvar a: Int = x + {};\n", f);
+					code += std::format("\tvar q = Pair{}{{x = a, y = p.y}};\n", i);
+					code += std::format("\tvar t = Templ{}<{{Int, {}}}>{{}};\n", i, f % 7);
+					code += "\tif(a < 10){\n\t\tvar b: Int = a * 2;\n\t\tout = copy b;\n\t}else{\n\t\tout = copy t.v;\n\t}\n";
+
+					if(i > 0 && f == 0){
+						code += std::format("\ta = a + dep.g{};\n", i - 1);
+						code += std::format("\tvar d = dep.Pair{}{{}};\n", i - 1);
+						code += "\ta = a + d.y;\n";
+					}
+
+					if(f > 0){
+						code += std::format("\ta = a + fn{}_{}(a, q, out);\n", i, f - 1);
+					}
+
+					code += "\treturn a + q.x;\n}\n\n";
+				}
+
+				if(i == 0){
+					code += std::format(
+						"func entry = () #entry -> Int {{\n\tvar out: Int = 0;\n\tvar p = Pair0{{}};\n\treturn fn0_{}(3, p, out);\n}}\n",
+						funcs_per_source - 1
+					);
+				}
+
+				sources.emplace_back(std::format("f{}.pthr", i), std::move(code));
+			}
+
+			return sources;
+		};
+
+
+
+		auto generateTemplateInstances(uint32_t num_instances) noexcept -> GeneratedSource {
+			auto code = std::string("struct Templ = <{T: Type, DEFAULT: T}> {\n\tvar v: T = DEFAULT;\n}\n\n");
+
+			for(uint32_t i = 0; i < num_instances; i+=1){
+				code += std::format("func f{} = () -> Int {{\n\tvar t = Templ<{{Int, {}}}>{{}};\n\treturn t.v;\n}}\n\n", i, i);
+			}
+
+			return GeneratedSource("templates.pthr", std::move(code));
+		};
+
+
+
+		// the two recursive calls have different arguments so that optimizations can't merge them
+		auto generateCalls(uint32_t depth, uint32_t num_struct_members, bool make_structs) noexcept -> GeneratedSource {
+			evo::debugAssert(num_struct_members > 0, "The struct must have at least 1 member");
+
+			auto code = std::string("struct S = {\n");
+			for(uint32_t i = 0; i < num_struct_members; i+=1){
+				code += std::format("\tvar m{}: Int = {};\n", i, i);
+			}
+			code += "}\n\n";
+
+			if(make_structs){
+				code += std::format("func make = (n: Int read) -> S {{\n\treturn S{{m0 = n - n, m{} = n}};\n}}\n\n", num_struct_members - 1);
+			}
+
+			code += "func walk = (n: Int read, s: S read) -> Int {\n";
+			code += "\tif(n < 1){\n\t\treturn 1 + s.m0;\n\t}\n";
+			if(make_structs){
+				code += "\tvar next = make(n);\n";
+				code += "\treturn 1 + walk(n - 1, next) + walk(n - 2, s);\n}\n\n";
+			}else{
+				code += "\treturn 1 + walk(n - 1, s) + walk(n - 2, s);\n}\n\n";
+			}
+
+			code += std::format("func entry = () #entry -> Int {{\n\tvar s = S{{}};\n\treturn walk({}, s);\n}}\n", depth);
+
+			return GeneratedSource("calls.pthr", std::move(code));
+		};
+
+
+		auto numCalls(uint32_t depth) noexcept -> uint64_t {
+			// number of calls of `walk(n - 1)` and of `walk(n)`
+			uint64_t prev_num_calls = 1;
+			uint64_t num_calls = 1;
+
+			for(uint32_t n = 1; n <= depth; n+=1){
+				prev_num_calls = std::exchange(num_calls, 1 + num_calls + prev_num_calls);
+			}
+
+			return num_calls;
+		};
+
+
+	};
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+
+#include <Evo.h>
+
+#include <filesystem>
+
+namespace panther{
+	namespace bench{
+
+
+		struct GeneratedSource{
+			std::filesystem::path path; // relative to the base path of the source manager
+			std::string code;
+		};
+
+
+		// sources that import the previous one, each with `funcs_per_source` functions
+		// 	(variables, struct initializers, public template instances, conditionals, calls with `read` / `write` params)
+		// 	the first source has the entry function
+		EVO_NODISCARD auto generateProgram(uint32_t num_sources, uint32_t funcs_per_source) noexcept -> std::vector<GeneratedSource>;
+
+		// a single source with `num_instances` different instances of the same template struct
+		EVO_NODISCARD auto generateTemplateInstances(uint32_t num_instances) noexcept -> GeneratedSource;
+
+		// a single source where the entry function starts a recursion (there are no loops) of `numCalls(depth)` calls
+		// 	each call passes an Int and a struct of `num_struct_members` Ints as read params
+		// 	if `make_structs`, each call also makes a new struct (with an initializer returned from another function)
+		// 	that it passes to one of its calls
+		// 	the entry function returns the number of calls
+		EVO_NODISCARD auto generateCalls(uint32_t depth, uint32_t num_struct_members, bool make_structs = false) noexcept
+			-> GeneratedSource;
+
+		// number of calls made by the program of `generateCalls()`
+		EVO_NODISCARD auto numCalls(uint32_t depth) noexcept -> uint64_t;
+
+
+	};
+};
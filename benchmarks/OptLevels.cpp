@@ -0,0 +1,49 @@
+#include "./Benchmarks.h"
+
+
+namespace panther{
+	namespace bench{
+
+		static constexpr uint32_t DEPTH = 32;
+		static constexpr uint32_t NUM_STRUCT_MEMBERS = 2;
+
+		// the fastest run is reported
+		static constexpr uint32_t NUM_RUNS = 3;
+
+
+		auto optLevels() noexcept -> int {
+			const uint64_t num_calls = numCalls(DEPTH);
+
+			evo::print(std::format(
+				"Run time of generated code ({} calls with a {} byte struct read param, fastest of {} runs)\n",
+				num_calls, NUM_STRUCT_MEMBERS * sizeof(uint64_t), NUM_RUNS
+			));
+			evo::print("opt level | run time (ms) | ns per call | speedup over O0\n");
+
+			const auto opt_levels = std::to_array<llvmint::OptLevel>({
+				llvmint::OptLevel::O0, llvmint::OptLevel::O1, llvmint::OptLevel::O2, llvmint::OptLevel::O3
+			});
+
+			std::optional<double> o0_run_time{};
+
+			for(llvmint::OptLevel opt_level : opt_levels){
+				const std::optional<double> run_time = timeCalls(DEPTH, NUM_STRUCT_MEMBERS, false, opt_level, NUM_RUNS);
+				if(run_time.has_value() == false){ return 1; }
+
+				if(o0_run_time.has_value() == false){ o0_run_time = run_time; }
+
+				evo::print(std::format(
+					"{:>9} | {:>13.1f} | {:>11.2f} | {:>14.2f}x\n",
+					std::format("O{}", evo::uint(opt_level)),
+					*run_time,
+					*run_time * 1e6 / double(num_calls),
+					*o0_run_time / std::max(*run_time, 1e-3)
+				));
+			}
+
+			return 0;
+		};
+
+
+	};
+};
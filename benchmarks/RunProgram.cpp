@@ -0,0 +1,94 @@
+#include "./Benchmarks.h"
+
+#include "PIRToLLVMIR.h"
+
+
+namespace panther{
+	namespace bench{
+
+
+		auto runProgram(const std::vector<GeneratedSource>& sources, llvmint::OptLevel opt_level) noexcept
+		-> std::optional<ProgramRun> {
+			auto message_counter = MessageCounter();
+			auto source_manager = SourceManager(SourceManager::Config{.basePath = "bench"}, message_counter.getCallback());
+			addSources(source_manager, sources);
+
+			if(source_manager.tokenize() > 0 || source_manager.parse() > 0){ return std::nullopt; }
+
+			source_manager.initBuiltinTypes();
+			source_manager.initIntrinsics();
+			if(source_manager.semanticAnalysis() > 0 || message_counter.getNumMessages() > 0){ return std::nullopt; }
+
+			if(source_manager.hasEntry() == false){
+				evo::print("Generated code has no entry function\n");
+				return std::nullopt;
+			}
+
+
+			auto llvm_context = llvmint::Context();
+			llvm_context.init();
+
+			auto pir_to_llvmir = PIRToLLVMIR();
+			const std::string init_err = pir_to_llvmir.init("run_program", llvm_context, "", llvmint::TargetConfig(), opt_level);
+			if(init_err.empty() == false){
+				evo::print(std::format("Failed to set target: {}\n", init_err));
+				pir_to_llvmir.shutdown();
+				llvm_context.shutdown();
+				return std::nullopt;
+			}
+
+			pir_to_llvmir.initLibC();
+			pir_to_llvmir.lower(source_manager);
+			pir_to_llvmir.addRuntime(source_manager.getEntry());
+			pir_to_llvmir.optimize();
+
+			auto program_run = ProgramRun();
+			program_run.timeMS = timeMS([&](){ program_run.returnCode = pir_to_llvmir.run<uint64_t>("main"); });
+
+			pir_to_llvmir.shutdown();
+			llvm_context.shutdown();
+
+			return program_run;
+		};
+
+
+
+		auto timeCalls(
+			uint32_t depth, uint32_t num_struct_members, bool make_structs, llvmint::OptLevel opt_level, uint32_t num_runs
+		) noexcept -> std::optional<double> {
+			const auto fastest_run = [&](uint32_t program_depth) noexcept -> std::optional<double> {
+				const auto sources = std::vector<GeneratedSource>{generateCalls(program_depth, num_struct_members, make_structs)};
+
+				std::optional<double> fastest{};
+
+				for(uint32_t run = 0; run < num_runs; run+=1){
+					const std::optional<ProgramRun> program_run = runProgram(sources, opt_level);
+					if(program_run.has_value() == false){ return std::nullopt; }
+
+					if(program_run->returnCode != numCalls(program_depth)){
+						evo::print(std::format(
+							"Generated code returned {} (expected {} calls)\n", program_run->returnCode, numCalls(program_depth)
+						));
+						return std::nullopt;
+					}
+
+					if(fastest.has_value() == false || program_run->timeMS < *fastest){
+						fastest = program_run->timeMS;
+					}
+				}
+
+				return fastest;
+			};
+
+			const std::optional<double> compile_time = fastest_run(0);
+			if(compile_time.has_value() == false){ return std::nullopt; }
+
+			const std::optional<double> total_time = fastest_run(depth);
+			if(total_time.has_value() == false){ return std::nullopt; }
+
+			return std::max(*total_time - *compile_time, 0.0);
+		};
+
+
+	};
+};
@@ -0,0 +1,46 @@
+#include "./Benchmarks.h"
+
+
+namespace panther{
+	namespace bench{
+
+		static constexpr uint32_t DEPTH = 30;
+
+		// 256 bytes (returned with sret and passed as a pointer), and 16 bytes (returned and passed by value) to compare
+		static constexpr auto NUM_STRUCT_MEMBERS = std::to_array<uint32_t>({32, 2});
+
+		// the fastest run is reported
+		static constexpr uint32_t NUM_RUNS = 3;
+
+
+		auto structs() noexcept -> int {
+			const uint64_t num_calls = numCalls(DEPTH);
+
+			evo::print(std::format(
+				"Making a struct in each call and passing it to the next call ({} calls, fastest of {} runs)\n", num_calls, NUM_RUNS
+			));
+			evo::print("struct size | opt level | run time (ms) | ns per call\n");
+
+			const auto opt_levels = std::to_array<llvmint::OptLevel>({llvmint::OptLevel::O0, llvmint::OptLevel::O2});
+
+			for(uint32_t num_struct_members : NUM_STRUCT_MEMBERS){
+				for(llvmint::OptLevel opt_level : opt_levels){
+					const std::optional<double> run_time = timeCalls(DEPTH, num_struct_members, true, opt_level, NUM_RUNS);
+					if(run_time.has_value() == false){ return 1; }
+
+					evo::print(std::format(
+						"{:>5} bytes | {:>9} | {:>13.1f} | {:>11.2f}\n",
+						num_struct_members * sizeof(uint64_t),
+						std::format("O{}", evo::uint(opt_level)),
+						*run_time,
+						*run_time * 1e6 / double(num_calls)
+					));
+				}
+			}
+
+			return 0;
+		};
+
+
+	};
+};
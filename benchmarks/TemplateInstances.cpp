@@ -0,0 +1,63 @@
+#include "./Benchmarks.h"
+
+
+namespace panther{
+	namespace bench{
+
+		// each count is double the previous, so the time per instance stays the same if lookup of types is linear
+		static constexpr auto NUM_INSTANCES = std::to_array<uint32_t>({1'000, 2'000, 4'000, 8'000, 16'000});
+
+		// the fastest run of each count is reported
+		static constexpr uint32_t NUM_RUNS = 3;
+
+
+		// wall time of semantic analysis in milliseconds
+		static auto run_semantic_analysis(const GeneratedSource& source) noexcept -> std::optional<double> {
+			auto message_counter = MessageCounter();
+			auto source_manager = SourceManager(SourceManager::Config{.basePath = "bench"}, message_counter.getCallback());
+			addSources(source_manager, {source});
+
+			if(source_manager.tokenize() > 0 || source_manager.parse() > 0){ return std::nullopt; }
+
+			bool failed = false;
+			const double semantic_analysis_time = timeMS([&](){
+				source_manager.initBuiltinTypes();
+				source_manager.initIntrinsics();
+				failed = source_manager.semanticAnalysis() > 0;
+			});
+			if(failed || message_counter.getNumMessages() > 0){ return std::nullopt; }
+
+			return semantic_analysis_time;
+		};
+
+
+
+		auto templateInstances() noexcept -> int {
+			evo::print(std::format("Template instances (semantic analysis, fastest of {} runs)\n", NUM_RUNS));
+			evo::print("instances |       ms | us / instance\n");
+
+			for(const uint32_t num_instances : NUM_INSTANCES){
+				const GeneratedSource source = generateTemplateInstances(num_instances);
+
+				std::optional<double> fastest{};
+
+				for(uint32_t run = 0; run < NUM_RUNS; run+=1){
+					const std::optional<double> semantic_analysis_time = run_semantic_analysis(source);
+					if(semantic_analysis_time.has_value() == false){ return 1; }
+
+					if(fastest.has_value() == false || *semantic_analysis_time < *fastest){
+						fastest = semantic_analysis_time;
+					}
+				}
+
+				evo::print(std::format(
+					"{:>9} | {:>8.1f} | {:>13.2f}\n", num_instances, *fastest, *fastest * 1000 / double(num_instances)
+				));
+			}
+
+			return 0;
+		};
+
+
+	};
+};
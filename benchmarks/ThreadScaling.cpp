@@ -0,0 +1,119 @@
+#include "./Benchmarks.h"
+
+
+namespace panther{
+	namespace bench{
+
+		static constexpr uint32_t NUM_SOURCES = 64;
+		static constexpr uint32_t FUNCS_PER_SOURCE = 500;
+
+		// the fastest run of each thread count is reported
+		static constexpr uint32_t NUM_RUNS = 3;
+
+
+		struct PhaseTimes{
+			double tokenize;
+			double parse;
+			double globals; // semantic analysis of everything other than function bodies
+			double funcBodies;
+
+			EVO_NODISCARD auto total() const noexcept -> double {
+				return this->tokenize + this->parse + this->globals + this->funcBodies;
+			};
+		};
+
+
+		static auto run_frontend(const std::vector<GeneratedSource>& sources, evo::uint num_threads) noexcept
+			-> std::optional<PhaseTimes>
+		{
+			auto message_counter = MessageCounter();
+			auto source_manager = SourceManager(
+				SourceManager::Config{.basePath = "bench", .numThreads = num_threads}, message_counter.getCallback()
+			);
+			addSources(source_manager, sources);
+
+			auto phase_times = PhaseTimes();
+			bool failed = false;
+
+			phase_times.tokenize = timeMS([&](){ failed |= source_manager.tokenize() > 0; });
+			if(failed){ return std::nullopt; }
+
+			phase_times.parse = timeMS([&](){ failed |= source_manager.parse() > 0; });
+			if(failed){ return std::nullopt; }
+
+			using SemanticAnalysisPhase = SourceManager::SemanticAnalysisPhase;
+			phase_times.globals = timeMS([&](){
+				source_manager.initBuiltinTypes();
+				source_manager.initIntrinsics();
+
+				for(
+					const SemanticAnalysisPhase phase : {
+						SemanticAnalysisPhase::GlobalIdentsAndImports,
+						SemanticAnalysisPhase::GlobalAliases,
+						SemanticAnalysisPhase::GlobalTypes,
+						SemanticAnalysisPhase::GlobalValues,
+					}
+				){
+					if(failed == false){ failed |= source_manager.semanticAnalysis(phase) > 0; }
+				}
+			});
+			if(failed){ return std::nullopt; }
+
+			phase_times.funcBodies = timeMS([&](){ failed |= source_manager.semanticAnalysis(SemanticAnalysisPhase::Runtime) > 0; });
+			if(failed || message_counter.getNumMessages() > 0){ return std::nullopt; }
+
+			return phase_times;
+		};
+
+
+
+		auto threadScaling(evo::uint max_threads) noexcept -> int {
+			const std::vector<GeneratedSource> sources = generateProgram(NUM_SOURCES, FUNCS_PER_SOURCE);
+
+			size_t num_bytes = 0;
+			for(const GeneratedSource& source : sources){
+				num_bytes += source.code.size();
+			}
+
+			evo::print(std::format(
+				"Thread scaling ({} sources, {} functions, {:.1f} MB, fastest of {} runs, ms)\n",
+				NUM_SOURCES, NUM_SOURCES * FUNCS_PER_SOURCE, double(num_bytes) / 1e6, NUM_RUNS
+			));
+			evo::print("threads | tokenize |    parse | sema (globals) | sema (func bodies) |    total | speedup\n");
+
+			std::optional<double> single_thread_total{};
+
+			for(evo::uint num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+				std::optional<PhaseTimes> fastest{};
+
+				for(uint32_t run = 0; run < NUM_RUNS; run+=1){
+					const std::optional<PhaseTimes> phase_times = run_frontend(sources, num_threads);
+					if(phase_times.has_value() == false){ return 1; }
+
+					if(fastest.has_value() == false || phase_times->total() < fastest->total()){
+						fastest = phase_times;
+					}
+				}
+
+				if(single_thread_total.has_value() == false){
+					single_thread_total = fastest->total();
+				}
+
+				evo::print(std::format(
+					"{:>7} | {:>8.1f} | {:>8.1f} | {:>14.1f} | {:>18.1f} | {:>8.1f} | {:>6.2f}x\n",
+					num_threads,
+					fastest->tokenize,
+					fastest->parse,
+					fastest->globals,
+					fastest->funcBodies,
+					fastest->total(),
+					*single_thread_total / fastest->total()
+				));
+			}
+
+			return 0;
+		};
+
+
+	};
+};
@@ -0,0 +1,58 @@
+#include "./Benchmarks.h"
+
+
+namespace panther{
+	namespace bench{
+
+		static constexpr uint32_t NUM_SOURCES = 64;
+		static constexpr uint32_t FUNCS_PER_SOURCE = 500;
+
+		// the fastest run is reported
+		static constexpr uint32_t NUM_RUNS = 5;
+
+
+		auto tokenizer() noexcept -> int {
+			const std::vector<GeneratedSource> sources = generateProgram(NUM_SOURCES, FUNCS_PER_SOURCE);
+
+			size_t num_bytes = 0;
+			for(const GeneratedSource& source : sources){
+				num_bytes += source.code.size();
+			}
+
+			std::optional<double> fastest{};
+			size_t num_tokens = 0;
+
+			for(uint32_t run = 0; run < NUM_RUNS; run+=1){
+				auto message_counter = MessageCounter();
+				auto source_manager = SourceManager(SourceManager::Config{.basePath = "bench"}, message_counter.getCallback());
+				addSources(source_manager, sources);
+
+				bool failed = false;
+				const double tokenize_time = timeMS([&](){ failed = source_manager.tokenize() > 0; });
+				if(failed || message_counter.getNumMessages() > 0){ return 1; }
+
+				if(fastest.has_value() == false || tokenize_time < *fastest){
+					fastest = tokenize_time;
+				}
+
+				num_tokens = 0;
+				for(const Source& source : source_manager.getSources()){
+					num_tokens += source.tokens.size();
+				}
+			}
+
+			evo::print(std::format(
+				"Tokenizer ({} sources, {:.1f} MB, {} tokens, 1 thread, fastest of {} runs)\n",
+				NUM_SOURCES, double(num_bytes) / 1e6, num_tokens, NUM_RUNS
+			));
+			evo::print(std::format(
+				"{:.1f} ms, {:.1f} MB/s, {:.1f} M tokens/s\n",
+				*fastest, double(num_bytes) / 1e3 / *fastest, double(num_tokens) / 1e3 / *fastest
+			));
+
+			return 0;
+		};
+
+
+	};
+};
@@ -0,0 +1,65 @@
+#include "./Benchmarks.h"
+
+
+#include <Evo.h>
+
+#include <charconv>
+#include <thread>
+
+
+// usage: benchmarks <name> [args]
+// 	threads [max threads]: wall time of each frontend phase for 1, 2, 4, ... threads
+// 		(max threads defaults to the number of hardware threads)
+// 	templates: time of semantic analysis for an increasing number of instances of a template struct
+// 	tokenizer: throughput of tokenizing the generated program on a single thread
+// 	allocas: checks that every alloca of the lowered LLVM IR is in the entry block of its function
+// 	calls: run time of generated code that mostly makes calls with read params of different sizes
+// 	optlevels: run time of the generated code of `calls` at O0, O1, O2, and O3
+// 	structs: run time of generated code that makes a 256 byte struct in each call and passes it to the next call
+auto main(int argc, const char* args[]) noexcept -> int {
+	const std::string_view name = argc > 1 ? std::string_view(args[1]) : std::string_view();
+
+	if(name == "threads"){
+		evo::uint max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+		if(argc > 2){
+			const std::string_view max_threads_str = args[2];
+			const std::from_chars_result result = std::from_chars(
+				max_threads_str.data(), max_threads_str.data() + max_threads_str.size(), max_threads
+			);
+			if(result.ec != std::errc() || max_threads == 0){
+				evo::print("max threads must be a positive integer\n");
+				return 1;
+			}
+		}
+
+		return panther::bench::threadScaling(max_threads);
+	}
+
+	if(name == "templates"){
+		return panther::bench::templateInstances();
+	}
+
+	if(name == "tokenizer"){
+		return panther::bench::tokenizer();
+	}
+
+	if(name == "allocas"){
+		return panther::bench::entryAllocas();
+	}
+
+	if(name == "calls"){
+		return panther::bench::calls();
+	}
+
+	if(name == "optlevels"){
+		return panther::bench::optLevels();
+	}
+
+	if(name == "structs"){
+		return panther::bench::structs();
+	}
+
+	evo::print("usage: benchmarks threads [max threads] | templates | tokenizer | allocas | calls | optlevels | structs\n");
+	return 1;
+};
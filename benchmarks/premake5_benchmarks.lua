@@ -0,0 +1,35 @@
+-- premake5
+
+
+project "benchmarks"
+	kind "ConsoleApp"
+	-- staticruntime "On"
+	
+
+	targetdir(target.bin)
+	objdir(target.obj)
+
+	files {
+		"./**.h",
+		"./**.cpp",
+	}
+
+	
+
+	includedirs{
+		(config.location .. "/libs"),
+
+		"../include/",
+		"./",
+	}
+
+	links{
+		"Evo",
+		"Panther_frontend",
+		"LLVM_interface",
+	}
+
+
+
+
+project "*"
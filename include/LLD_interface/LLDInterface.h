@@ -3,6 +3,8 @@
 
 #include <Evo.h>
 
+#include <span>
+
 namespace panther{
 
 
@@ -16,6 +18,17 @@ namespace panther{
 				Wasm,
 			};
 
+			struct Config{
+				// used to select the C runtime and dynamic linker (Gnu only)
+				std::string targetTriple{};
+
+				// produce a position independent executable (Gnu only)
+				bool pie = true;
+
+				// 0 lets lld decide (Gnu only)
+				evo::uint numThreads = 0;
+			};
+
 			struct LinkerOutput{
 				int returnCode;
 				bool canRunAgain;
@@ -27,15 +40,28 @@ namespace panther{
 			};
 
 		public:
-			LLDInterface() = default;
+			LLDInterface(const Config& _config) noexcept : config(_config) {};
 			~LLDInterface() = default;
 
 			// auto init() noexcept -> void;
 
+
+			// linker that is used for executables of `target_triple`
+			EVO_NODISCARD static auto getLinker(std::string_view target_triple) noexcept -> Linker;
+
 			EVO_NODISCARD auto link(const std::string& input_file_path, const std::string& target_output, Linker linker ) noexcept -> LinkerOutput;
+
+			EVO_NODISCARD auto link(std::span<const std::string> input_file_paths, const std::string& target_output, Linker linker) noexcept
+			-> LinkerOutput;
+
+			// links object files that are in memory without writing them to disk first
+			// 	(on platforms other than Linux they are written to the temp directory, as lld can only read files by path)
+			EVO_NODISCARD auto linkInMemory(
+				std::span<const std::vector<evo::byte>> object_files, const std::string& target_output, Linker linker
+			) noexcept -> LinkerOutput;
 	
 		private:
-			
+			Config config;
 	};
 
 
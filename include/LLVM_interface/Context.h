@@ -24,14 +24,19 @@ namespace panther{
 
 				EVO_NODISCARD inline auto isInitialized() const noexcept -> bool { return this->context != nullptr; };
 
-				EVO_NODISCARD inline auto getContext() noexcept -> llvm::LLVMContext& {
-					evo::debugAssert(this->isInitialized(), "Cannot get context when not initialized");
-					return *this->context;
-				};
+				EVO_NODISCARD auto getContext() noexcept -> llvm::LLVMContext&;
+
+				// names of values that aren't global values are not kept (makes creating IR faster)
+				// 	should be set before creating any IR
+				auto setDiscardValueNames(bool discard) noexcept -> void;
+				EVO_NODISCARD auto shouldDiscardValueNames() const noexcept -> bool;
 
 		
 			private:
-				llvm::LLVMContext* context = nullptr;
+				// thread safe context so that it can be shared with the JIT (see ExecutionEngine)
+				llvm::orc::ThreadSafeContext* context = nullptr;
+
+				friend class ExecutionEngine;
 		};
 
 
@@ -17,8 +17,12 @@ namespace panther{
 					evo::debugAssert(this->hasCreatedEngine() == false, "ExecutionEngine destructor run without shutting down");
 				};
 
-				// creates copy of the module (module.getClone())
-				auto createEngine(const class Module& module) noexcept -> void;
+				// the module is moved into the engine instead of being copied, so it can't be used afterwards
+				// functions are only compiled the first time they're called
+				// `num_compile_threads` of 0 means functions are compiled on the thread that calls them
+				// return is error message (empty if no error)
+				EVO_NODISCARD auto createEngine(class Module& module, class Context& context, evo::uint num_compile_threads) noexcept
+				-> std::string;
 
 				auto shutdownEngine() noexcept -> void;
 
@@ -36,13 +40,13 @@ namespace panther{
 				EVO_NODISCARD auto runFunction<void>(std::string_view func_name) noexcept -> void;
 
 
-				EVO_NODISCARD inline auto hasCreatedEngine() const noexcept -> bool { return this->engine != nullptr; };
+				EVO_NODISCARD inline auto hasCreatedEngine() const noexcept -> bool { return this->jit != nullptr; };
 
 			private:
 				EVO_NODISCARD auto getFuncAddress(std::string_view func_name) noexcept -> uint64_t;
 		
 			private:
-				llvm::ExecutionEngine* engine = nullptr;
+				llvm::orc::LLLazyJIT* jit = nullptr;
 		};
 
 
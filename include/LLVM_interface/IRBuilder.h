@@ -29,6 +29,11 @@ namespace panther{
 				EVO_NODISCARD auto createAlloca(llvm::Type* type, llvm::Value* array_length, evo::CStrProxy name = '\0') noexcept -> llvm::AllocaInst*;
 				EVO_NODISCARD auto createAlloca(llvm::Type* type, evo::CStrProxy name = '\0') noexcept -> llvm::AllocaInst*;
 
+				// creates the alloca at the end of the entry block of the current function (before its terminator)
+				// 	instead of at the insertion point, as mem2reg / SROA only promote allocas in the entry block
+				// the entry block must already have a terminator
+				EVO_NODISCARD auto createEntryBlockAlloca(llvm::Type* type, evo::CStrProxy name = '\0') noexcept -> llvm::AllocaInst*;
+
 				EVO_NODISCARD auto createLoad(llvm::Value* value, llvm::Type* type, evo::CStrProxy name = '\0') noexcept -> llvm::LoadInst*;
 				EVO_NODISCARD auto createLoad(llvm::AllocaInst* alloca, evo::CStrProxy name = '\0') noexcept -> llvm::LoadInst*;
 
@@ -110,7 +115,10 @@ namespace panther{
 
 				EVO_NODISCARD auto valueBool(bool val) noexcept -> llvm::ConstantInt*;
 
-				EVO_NODISCARD auto valueString(evo::CStrProxy str, evo::CStrProxy name = '\0') noexcept -> llvm::GlobalVariable*;
+				// private constant in `module` (not the module of the current insertion point)
+				EVO_NODISCARD auto valueString(
+					class Module& module, evo::CStrProxy str, evo::CStrProxy name = '\0'
+				) noexcept -> llvm::GlobalVariable*;
 
 				EVO_NODISCARD auto valueGlobal(
 					class Module& module,
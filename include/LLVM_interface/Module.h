@@ -11,6 +11,13 @@ namespace panther{
 		
 
 		class Module{
+			public:
+				// the global values that are defined in a partition created by `split()`
+				struct Partition{
+					std::vector<llvm::Function*> funcs{};
+					std::vector<llvm::GlobalVariable*> globalVars{};
+				};
+
 			public:
 				Module(std::string_view name, llvm::LLVMContext& context);
 				~Module();
@@ -29,6 +36,7 @@ namespace panther{
 
 				EVO_NODISCARD auto getPointerSize() const noexcept -> unsigned;
 				EVO_NODISCARD auto getTypeSize(llvm::Type* type) const noexcept -> uint64_t;
+				EVO_NODISCARD auto getNumInstructions() const noexcept -> size_t;
 
 				EVO_NODISCARD auto print() const noexcept -> std::string;
 
@@ -38,19 +46,55 @@ namespace panther{
 				auto setTargetTriple(const std::string& target_triple) noexcept -> void;
 
 				// return is error message (empty if no error)
-				EVO_NODISCARD auto setDataLayout(const std::string& target_triple, std::string_view cpu, std::string_view features) noexcept -> std::string;
+				// `opt_level` is the optimization level used when generating machine code
+				EVO_NODISCARD auto setDataLayout(
+					const std::string& target_triple, const TargetConfig& target_config, OptLevel opt_level
+				) noexcept -> std::string;
+
+
+				// runs the default LLVM optimization pipeline for `opt_level`
+				// 	requires the data layout to be set
+				auto optimize(OptLevel opt_level) noexcept -> void;
 
 
 				// return nullopt means target machine cannot output object file
 				EVO_NODISCARD auto compileToObjectFile() noexcept -> evo::Result<std::vector<evo::byte>>;
 
+				// splits the module into `num_partitions` parts that are each compiled on their own thread
+				// 	the output only depends on `num_partitions` (not on the order the threads finish)
+				// 	internal symbols are made hidden so that they can be referenced between the object files
+				// 	the module should not be used afterwards
+				// return nullopt means target machine cannot output object file
+				EVO_NODISCARD auto compileToObjectFiles(evo::uint num_partitions) noexcept
+				-> evo::Result<std::vector<std::vector<evo::byte>>>;
+
+
+				// creates a module for each partition, and one more (last) for the definitions that aren't in any partition
+				// 	each module has the definitions of its partition (and copies of the internal constants it uses),
+				// 	and declarations of everything it uses from the other partitions
+				// 	internal symbols that are used by other partitions are made hidden so that they can be referenced between the object files
+				// 	the module should not be used afterwards
+				EVO_NODISCARD auto split(std::span<const Partition> partitions) noexcept -> std::vector<std::unique_ptr<Module>>;
+
+				// SHA-256 (as hex) of the module, the target machine config, and the compiler version
+				// 	(everything the output of `compileToObjectFile()` depends on)
+				// 	requires the data layout to be set
+				EVO_NODISCARD auto hash() const noexcept -> std::string;
+
+				// increment when a change to the compiler changes the generated object files of the same module
+				// 	(invalidates every object cache)
+				static constexpr uint32_t HASH_VERSION = 1;
+
 
 
 				EVO_NODISCARD inline auto getModule() const noexcept -> llvm::Module& { return *this->module; };
 
 			private:
+				Module(std::unique_ptr<llvm::Module>&& _module, const std::shared_ptr<llvm::TargetMachine>& _target_machine)
+					: module(_module.release()), target_machine(_target_machine) {};
 
-				EVO_NODISCARD auto get_clone() const noexcept -> std::unique_ptr<llvm::Module>;
+				// gives up ownership of the module (nothing else can be done with this Module afterwards)
+				EVO_NODISCARD auto release() noexcept -> std::unique_ptr<llvm::Module>;
 
 
 				friend class ExecutionEngine;
@@ -58,7 +102,8 @@ namespace panther{
 
 			private:
 				llvm::Module* module = nullptr;
-				llvm::TargetMachine* target_machine = nullptr;
+				// shared with the modules that are split from this one (see split())
+				std::shared_ptr<llvm::TargetMachine> target_machine{};
 		};
 
 
@@ -33,7 +33,10 @@ namespace llvm{
 	class Argument;
 	class StructType;
 
-	class ExecutionEngine;
+	namespace orc{
+		class ThreadSafeContext;
+		class LLLazyJIT;
+	};
 };
 
 
@@ -58,6 +61,52 @@ namespace panther{
 
 
 
+		enum class OptLevel{
+			O0, // no optimization
+			O1,
+			O2,
+			O3,
+		};
+
+
+
+		// llvm::Reloc::Model
+		enum class RelocModel{
+			Static,
+			PIC,
+			DynamicNoPIC,
+			ROPI,
+			RWPI,
+			ROPI_RWPI,
+		};
+
+
+		// llvm::CodeModel::Model
+		enum class CodeModel{
+			Default, // let the target decide
+			Tiny,
+			Small,
+			Kernel,
+			Medium,
+			Large,
+		};
+
+
+
+		struct TargetConfig{
+			// "native" means the CPU of the machine compiling (the target triple must have the same architecture)
+			std::string cpu = "generic";
+
+			// LLVM feature string (for example: "+avx2,+fma,-avx512f")
+			// 	if `cpu` is "native", the features of the host CPU are added before these
+			std::string features{};
+
+			RelocModel relocModel = RelocModel::PIC;
+			CodeModel codeModel = CodeModel::Default;
+		};
+
+
+
 		// Typesafe way to convert between llvm pointer types
 		// 	Example usage: panther::llvmint::ptrcast<llvm::Value>(constant)
 		template<class To, class From>
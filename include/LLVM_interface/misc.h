@@ -29,6 +29,12 @@ namespace panther{
 
 		auto setFuncNoReturn(llvm::Function* func) noexcept -> void;
 
+		auto setArgNoCapture(llvm::Argument* arg) noexcept -> void;
+
+		// marks the arg as the pointer the return value of type `type` is written to
+		auto setArgStructRet(llvm::Argument* arg, llvm::Type* type) noexcept -> void;
+		auto setCallArgStructRet(llvm::CallInst* call, llvm::Type* type) noexcept -> void;
+
 
 	};
 };
\ No newline at end of file
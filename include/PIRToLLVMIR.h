@@ -12,11 +12,14 @@
 
 #include <Evo.h>
 
+#include <unordered_map>
+
 #include "./LLVM_interface/Context.h"
 #include "./LLVM_interface/IRBuilder.h"
 #include "./LLVM_interface/Module.h"
 #include "./LLVM_interface/ExecutionEngine.h"
 #include "./LLVM_interface/misc.h"
+#include "./Trace.h"
 
 
 namespace panther{
@@ -30,26 +33,35 @@ namespace panther{
 			};
 
 
-			auto init(std::string_view name, llvmint::Context& context) noexcept -> void {
+			// `target_triple` being empty means the target triple of the machine compiling
+			// return is error message (empty if no error)
+			EVO_NODISCARD auto init(
+				std::string_view name,
+				llvmint::Context& context,
+				std::string_view target_triple,
+				const llvmint::TargetConfig& target_config,
+				llvmint::OptLevel optimization_level
+			) noexcept -> std::string {
 				evo::debugAssert(this->isInitialized() == false, "PIRToLLVMIR already initialized");
 
 				this->builder = new llvmint::IRBuilder(context.getContext());
 				this->module = new llvmint::Module(name, context.getContext());
+				this->context = &context;
+				this->opt_level = optimization_level;
+				this->discard_value_names = context.shouldDiscardValueNames();
 
 
-				const std::string target_triple = llvmint::Module::getDefaultTargetTriple();
-				
-
-
-				const std::string data_layout_err = this->module->setDataLayout(target_triple, "generic", "");
+				const std::string triple = target_triple.empty() ? llvmint::Module::getDefaultTargetTriple() : std::string(target_triple);
 
+				const std::string data_layout_err = this->module->setDataLayout(triple, target_config, this->opt_level);
 				if(data_layout_err.empty() == false){
-					// TODO: maybe handle this more?
-					evo::debugFatalBreak(data_layout_err);
+					return data_layout_err;
 				}
 
 
-				this->module->setTargetTriple(target_triple);
+				this->module->setTargetTriple(triple);
+
+				return std::string();
 			};
 
 
@@ -61,6 +73,9 @@ namespace panther{
 
 				delete this->module;
 				this->module = nullptr;
+
+				this->context = nullptr;
+				this->string_constants.clear();
 			};
 
 
@@ -93,6 +108,8 @@ namespace panther{
 					}
 				}
 
+				this->propagate_params_address_taken(sources);
+
 				for(Source& source_ref : sources){
 					this->source = &source_ref;
 
@@ -149,25 +166,67 @@ namespace panther{
 
 
 
+			// runs the LLVM optimization pipeline of the optimization level given in init()
+			// 	should be done after all lowering and before printing / compiling / running
+			auto optimize() noexcept -> void {
+				this->module->optimize(this->opt_level);
+			};
+
+
 			EVO_NODISCARD auto printLLVMIR() const noexcept -> std::string {
 				return this->module->print();
 			};
 
+			EVO_NODISCARD auto getNumLLVMInstructions() const noexcept -> size_t {
+				return this->module->getNumInstructions();
+			};
+
 
 			// return nullopt means target machine cannot output object file
 			EVO_NODISCARD auto compileToObjectFile() noexcept -> evo::Result<std::vector<evo::byte>> {
 				return this->module->compileToObjectFile();
 			};
 
+			// compiles the module as `num_partitions` object files on separate threads (see llvmint::Module::compileToObjectFiles)
+			EVO_NODISCARD auto compileToObjectFiles(evo::uint num_partitions) noexcept -> evo::Result<std::vector<std::vector<evo::byte>>> {
+				return this->module->compileToObjectFiles(num_partitions);
+			};
+
+
+
+			// splits the module into one module for each source (in the order of the sources),
+			// 	and one more (last) for the runtime, so that the object file of each can be cached on its own
+			// 	must be called after lowering, and only shutdown() can be called afterwards
+			EVO_NODISCARD auto splitBySource(SourceManager& source_manager) noexcept -> std::vector<std::unique_ptr<llvmint::Module>> {
+				auto partitions = std::vector<llvmint::Module::Partition>();
+				partitions.reserve(source_manager.getSources().size());
+
+				for(Source& source_ref : source_manager.getSources()){
+					llvmint::Module::Partition& partition = partitions.emplace_back();
+
+					for(const PIR::Func& func : source_ref.pir.funcs){
+						partition.funcs.emplace_back(func.llvmFunc);
+					}
+
+					for(PIR::Var::ID global_var_id : source_ref.pir.global_vars){
+						partition.globalVars.emplace_back(Source::getVar(global_var_id).llvm.global);
+					}
+				}
+
+				return this->module->split(partitions);
+			};
+
 
 
 			EVO_NODISCARD inline auto isInitialized() const noexcept -> bool { return this->builder != nullptr; };
 
 
+			// the module is moved into the JIT, so only shutdown() can be called afterwards
+			// `num_compile_threads` of 0 means functions are compiled on the thread that calls them
 			template<typename ReturnType>
-			EVO_NODISCARD inline auto run(std::string_view func_name) noexcept -> ReturnType {
+			EVO_NODISCARD inline auto run(std::string_view func_name, evo::uint num_compile_threads = 0) noexcept -> ReturnType {
 				auto execution_engine = llvmint::ExecutionEngine();
-				execution_engine.createEngine(*this->module);
+				this->create_engine(execution_engine, num_compile_threads);
 
 				const ReturnType output = execution_engine.runFunction<ReturnType>(func_name);
 
@@ -177,9 +236,9 @@ namespace panther{
 			};
 
 			template<>
-			inline auto run<void>(std::string_view func_name) noexcept -> void {
+			inline auto run<void>(std::string_view func_name, evo::uint num_compile_threads) noexcept -> void {
 				auto execution_engine = llvmint::ExecutionEngine();
-				execution_engine.createEngine(*this->module);
+				this->create_engine(execution_engine, num_compile_threads);
 
 				execution_engine.runFunction<void>(func_name);
 
@@ -189,6 +248,15 @@ namespace panther{
 
 
 		private:
+			inline auto create_engine(llvmint::ExecutionEngine& execution_engine, evo::uint num_compile_threads) noexcept -> void {
+				const std::string engine_err = execution_engine.createEngine(*this->module, *this->context, num_compile_threads);
+
+				if(engine_err.empty() == false){
+					evo::fatalBreak(std::format("Failed to create JIT: {}", engine_err));
+				}
+			};
+
+
 			inline auto lower_global_var(PIR::Var& var) noexcept -> void {
 				const std::string mangled_name = PIRToLLVMIR::mangle_name(*this->source, var);
 
@@ -238,19 +306,42 @@ namespace panther{
 				auto param_types = std::vector<llvm::Type*>();
 				auto param_infos = std::vector<llvmint::ParamInfo>();
 
+				// the return value is written directly into the memory of the caller (sret)
+				func.returnsByPointer = this->is_returned_by_pointer(func, return_type);
+				llvm::Type* return_value_type = return_type;
+				if(func.returnsByPointer){
+					param_types.emplace_back(llvmint::ptrcast<llvm::Type>(this->builder->getTypePtr()));
+					const auto deref = llvmint::ParamInfo::Dereferenceable(this->module->getTypeSize(return_type), false);
+					param_infos.emplace_back("ret", false, true, true, deref);
+
+					return_type = this->builder->getTypeVoid();
+				}
+
 				for(size_t i = 0; i < func.params.size(); i+=1){
-					const PIR::Param& param = this->source->getParam(func.params[i]);
+					PIR::Param& param = this->source->getParam(func.params[i]);
 
 					llvm::Type* param_type = this->get_type(this->src_manager->getType(param.type));
-					// param_types.emplace_back(param_type);
-					param_types.emplace_back(llvmint::ptrcast<llvm::Type>(this->builder->getTypePtr()));
+					const std::string_view param_name = this->source->getToken(param.ident).value.string;
 
-					using ParamKind = AST::FuncParams::Param::Kind;
-					const bool readonly = false;
-					const bool nonnull = true;
-					const bool noalias = param.kind == ParamKind::Write;
-					const auto deref = llvmint::ParamInfo::Dereferenceable(this->module->getTypeSize(param_type), false);
-					param_infos.emplace_back(this->source->getToken(param.ident).value.string, readonly, nonnull, noalias, deref);
+					param.isPassedByValue = this->is_passed_by_value(param, param_type);
+
+					if(param.isPassedByValue){
+						param_types.emplace_back(param_type);
+						param_infos.emplace_back(param_name);
+
+					}else{
+						param_types.emplace_back(llvmint::ptrcast<llvm::Type>(this->builder->getTypePtr()));
+
+						// nocapture is set after lowering the body of the function (see lower_func)
+						// readonly only means that the function doesn't write through this pointer
+						// 	(the memory may still be written through another pointer, like a global variable)
+						using ParamKind = AST::FuncParams::Param::Kind;
+						const bool readonly = param.kind == ParamKind::Read;
+						const bool nonnull = true;
+						const bool noalias = param.kind == ParamKind::Write;
+						const auto deref = llvmint::ParamInfo::Dereferenceable(this->module->getTypeSize(param_type), false);
+						param_infos.emplace_back(param_name, readonly, nonnull, noalias, deref);
+					}
 				}
 
 
@@ -262,28 +353,36 @@ namespace panther{
 
 
 
-				if(func.params.empty()){
-					this->builder->createBasicBlock(llvm_func, "begin");
-					
-				}else{
-					llvmint::setupFuncParams(llvm_func, param_infos);
+				// every alloca of the function goes into the setup block (see IRBuilder::createEntryBlockAlloca)
+				// 	so that they can all be promoted to registers
+				llvm::BasicBlock* setup = this->builder->createBasicBlock(llvm_func, "setup");
+				llvm::BasicBlock* begin = this->builder->createBasicBlock(llvm_func, "begin");
 
-					llvm::BasicBlock* setup = this->builder->createBasicBlock(llvm_func, "setup");
-					llvm::BasicBlock* begin = this->builder->createBasicBlock(llvm_func, "begin");
+				this->builder->setInsertionPoint(setup);
 
-					this->builder->setInsertionPoint(setup);
+				if(param_infos.empty() == false){
+					llvmint::setupFuncParams(llvm_func, param_infos);
 
 					const std::vector<llvm::Argument*> arguments = llvmint::getFuncArguments(llvm_func);
-					for(size_t i = 0; i < arguments.size(); i+=1){
-						llvm::AllocaInst* arg_alloca = this->builder->createAlloca(param_types[i], std::format("{}.addr", param_infos[i].name));
-						this->source->getParam(func.params[i]).alloca = arg_alloca;
 
-						this->builder->createStore(arg_alloca, llvmint::ptrcast<llvm::Value>(arguments[i]));
+					if(func.returnsByPointer){
+						llvmint::setArgStructRet(arguments.front(), return_value_type);
 					}
 
-					this->builder->createBranch(begin);
+					const size_t first_param_index = func.returnsByPointer ? 1 : 0;
+					for(size_t i = 0; i < func.params.size(); i+=1){
+						const size_t arg_index = i + first_param_index;
+						PIR::Param& param = this->source->getParam(func.params[i]);
 
+						const std::string alloca_name = this->value_name("{}.{}", param_infos[arg_index].name, param.isPassedByValue ? "value" : "addr");
+						llvm::AllocaInst* arg_alloca = this->builder->createAlloca(param_types[arg_index], alloca_name);
+						param.alloca = arg_alloca;
+
+						this->builder->createStore(arg_alloca, llvmint::ptrcast<llvm::Value>(arguments[arg_index]));
+					}
 				}
+
+				this->builder->createBranch(begin);
 			};
 
 
@@ -315,6 +414,10 @@ namespace panther{
 
 
 			inline auto lower_func(PIR::Func& func) noexcept -> void {
+				const auto trace_span = Trace::Span("PIRToLLVMIR::lower_func", [&]() noexcept -> std::string {
+					return PIRToLLVMIR::mangle_name(*this->source, func);
+				});
+
 				this->current_func = &func;
 
 				this->builder->setInsertionPointAtBack(func.llvmFunc);
@@ -337,6 +440,19 @@ namespace panther{
 				}
 
 
+				// only known after lowering the body (if the address of the param is taken or passed to another function)
+				if(func.params.empty() == false){
+					const std::vector<llvm::Argument*> arguments = llvmint::getFuncArguments(func.llvmFunc);
+					const size_t first_param_index = func.returnsByPointer ? 1 : 0;
+
+					for(size_t i = 0; i < func.params.size(); i+=1){
+						const PIR::Param& param = this->source->getParam(func.params[i]);
+
+						if(param.isPassedByValue == false && param.mayBeCaptured == false){
+							llvmint::setArgNoCapture(arguments[i + first_param_index]);
+						}
+					}
+				}
 
 
 				this->current_func = nullptr;
@@ -346,20 +462,20 @@ namespace panther{
 
 
 			inline auto lower_var(PIR::Var& var) noexcept -> void {
-				const std::string ident = std::string(this->source->getToken(var.ident).value.string);
+				const std::string ident = this->value_name("{}", this->source->getToken(var.ident).value.string);
 
 				const PIR::Type& type = this->src_manager->getType(var.type);
 
 				llvm::Type* llvm_type = this->get_type(type);
 
-				llvm::AllocaInst* alloca_val = this->builder->createAlloca(llvm_type, ident);
+				llvm::AllocaInst* alloca_val = this->builder->createEntryBlockAlloca(llvm_type, ident);
 
 				var.llvm.alloca = alloca_val;
 				var.is_alloca = true;
 
 
 				if(var.value.kind != PIR::Expr::Kind::Uninit){
-					this->builder->createStore(alloca_val, this->get_value(var.value));
+					this->lower_value_into(var.value, llvmint::ptrcast<llvm::Value>(alloca_val));
 				}
 
 			};
@@ -424,7 +540,14 @@ namespace panther{
 
 			inline auto lower_return(const PIR::Return& ret) noexcept -> void {
 				if(ret.value.has_value()){
-					this->builder->createRet(this->get_value(*ret.value));
+					if(this->current_func->returnsByPointer){
+						llvm::Argument* ret_ptr = llvmint::getFuncArguments(this->current_func->llvmFunc).front();
+						this->lower_value_into(*ret.value, llvmint::ptrcast<llvm::Value>(ret_ptr));
+						this->builder->createRet();
+
+					}else{
+						this->builder->createRet(this->get_value(*ret.value));
+					}
 
 				}else{
 					this->builder->createRet();
@@ -440,6 +563,7 @@ namespace panther{
 				);
 
 
+				// not lowered into `dst` directly as the value may use `dst` (for example: `x = Vec2{x = x.y, y = x.x}`)
 				llvm::Value* dst = this->get_concrete_value(assignment.dst);
 				llvm::Value* value = this->get_value(assignment.value);
 
@@ -447,22 +571,71 @@ namespace panther{
 			};
 
 
+			// constructs the value directly in `dst` instead of in a temporary that's then copied into `dst`
+			// 	`dst` must not be used by `value` (for example: a new variable or the return value)
+			inline auto lower_value_into(const PIR::Expr& value, llvm::Value* dst) noexcept -> void {
+				switch(value.kind){
+					case PIR::Expr::Kind::Initializer: {
+						const PIR::Initializer& initializer = this->source->getInitializer(value.initializer);
+						llvm::Type* initializer_llvm_type = this->get_type(this->src_manager->getType(initializer.type));
+
+						for(size_t i = 0; i < initializer.memberVals.size(); i+=1){
+							if(initializer.memberVals[i].kind == PIR::Expr::Kind::None){ continue; } // skip {none} values
+
+							const std::string gep_name = this->value_name(".initializer.{}.GEP", i);
+							llvm::Value* gep_value = this->builder->createGEP(dst, initializer_llvm_type, {0, int32_t(i)}, gep_name);
+
+							this->lower_value_into(initializer.memberVals[i], gep_value);
+						}
+
+						return;
+					} break;
+
+					case PIR::Expr::Kind::FuncCall: {
+						const PIR::FuncCall& func_call = this->source->getFuncCall(value.funcCall);
+						if(func_call.kind != PIR::FuncCall::Kind::Func){ break; }
+
+						if(Source::getFunc(func_call.func).returnsByPointer == false){ break; }
+
+						this->lower_func_call_into(func_call, dst);
+						return;
+					} break;
+
+					default: break;
+				};
+
+				this->builder->createStore(dst, this->get_value(value));
+			};
+
+
 
 
 
 
 
 
-			inline auto create_func_call_args(const PIR::FuncCall& func_call) noexcept -> std::vector<llvm::Value*> {
+			// `return_ptr` is where the return value is written to (only if the function returns by pointer)
+			inline auto create_func_call_args(const PIR::FuncCall& func_call, llvm::Value* return_ptr = nullptr) noexcept
+			-> std::vector<llvm::Value*> {
 				auto args = std::vector<llvm::Value*>();
 
-				// const PIR::Func& func = Source::getFunc(func_call.func);
+				const PIR::Func& func = Source::getFunc(func_call.func);
+				evo::debugAssert(func.returnsByPointer == (return_ptr != nullptr), "Function returns by pointer must match if `return_ptr` is given");
+
+				if(return_ptr != nullptr){
+					args.emplace_back(return_ptr);
+				}
 
 				for(size_t i = 0; i < func_call.args.size(); i+=1){
 					const PIR::Expr& arg = func_call.args[i];
+					const PIR::Param& param = func_call.func.source.getParam(func.params[i]);
 
-					// const PIR::Type::ID param_type = func_call.func.source.getParam(func.params[i]).type);
-					args.emplace_back(this->get_value(arg, true));
+					if(param.isPassedByValue){
+						args.emplace_back(this->get_value(arg));
+					}else{
+						this->set_param_may_be_captured(arg);
+						args.emplace_back(this->get_value(arg, true));
+					}
 				}
 
 				return args;
@@ -491,14 +664,14 @@ namespace panther{
 							case PIR::Intrinsic::Kind::__printHelloWorld: {
 								evo::debugAssert(this->libc.puts != nullptr, "libc was not initialized");
 
-								static llvm::GlobalVariable* hello_world_str = this->builder->valueString("Hello World, I'm Panther!", "hello_world_str");
+								llvm::GlobalVariable* hello_world_str = this->get_string_constant("Hello World, I'm Panther!", "hello_world_str");
 								this->builder->createCall(this->libc.puts, { llvmint::ptrcast<llvm::Value>(hello_world_str) });
 							} break;
 
 							case PIR::Intrinsic::Kind::__printInt: {
 								evo::debugAssert(this->libc.printf != nullptr, "libc was not initialized");
 								
-								static llvm::GlobalVariable* print_int_str = this->builder->valueString("Int: %lli\n", "print_int_str");
+								llvm::GlobalVariable* print_int_str = this->get_string_constant("Int: %lli\n", "print_int_str");
 								this->builder->createCall(
 									this->libc.printf, { llvmint::ptrcast<llvm::Value>(print_int_str), this->get_value(func_call.args[0]) }
 								);
@@ -507,7 +680,7 @@ namespace panther{
 							case PIR::Intrinsic::Kind::__printUInt: {
 								evo::debugAssert(this->libc.printf != nullptr, "libc was not initialized");
 								
-								static llvm::GlobalVariable* print_uint_str = this->builder->valueString("UInt: %llu\n", "print_uint_str");
+								llvm::GlobalVariable* print_uint_str = this->get_string_constant("UInt: %llu\n", "print_uint_str");
 								this->builder->createCall(
 									this->libc.printf, { llvmint::ptrcast<llvm::Value>(print_uint_str), this->get_value(func_call.args[0]) }
 								);
@@ -525,12 +698,12 @@ namespace panther{
 								this->builder->createCondBranch(bool_value, true_block, false_block);
 
 								this->builder->setInsertionPoint(true_block);
-								static llvm::GlobalVariable* true_str = this->builder->valueString("Bool: true");
+								llvm::GlobalVariable* true_str = this->get_string_constant("Bool: true");
 								this->builder->createCall(this->libc.puts, { llvmint::ptrcast<llvm::Value>(true_str) });
 								this->builder->createBranch(end_block);
 
 								this->builder->setInsertionPoint(false_block);
-								static llvm::GlobalVariable* false_str = this->builder->valueString("Bool: false");
+								llvm::GlobalVariable* false_str = this->get_string_constant("Bool: false");
 								this->builder->createCall(this->libc.puts, { llvmint::ptrcast<llvm::Value>(false_str) });
 								this->builder->createBranch(end_block);
 
@@ -540,7 +713,7 @@ namespace panther{
 							case PIR::Intrinsic::Kind::__printSeparator: {
 								evo::debugAssert(this->libc.puts != nullptr, "libc was not initialized");
 
-								static llvm::GlobalVariable* separator_str = this->builder->valueString("------------------------------", "separator_str");
+								llvm::GlobalVariable* separator_str = this->get_string_constant("------------------------------", "separator_str");
 								this->builder->createCall(this->libc.puts, { llvmint::ptrcast<llvm::Value>(separator_str) });
 							} break;
 
@@ -556,6 +729,17 @@ namespace panther{
 			};
 
 
+			// for functions that return by pointer
+			inline auto lower_func_call_into(const PIR::FuncCall& func_call, llvm::Value* return_ptr) noexcept -> void {
+				const PIR::Func& func = Source::getFunc(func_call.func);
+				llvm::Type* return_type = this->get_type(this->src_manager->getType(func.returnType.typeID()));
+
+				const std::vector<llvm::Value*> args = this->create_func_call_args(func_call, return_ptr);
+				llvm::CallInst* call = this->builder->createCall(func.llvmFunc, args, '\0');
+				llvmint::setCallArgStructRet(call, return_type);
+			};
+
+
 			inline auto lower_unreachable() noexcept -> void {
 				this->builder->createUnreachable();
 			};
@@ -667,7 +851,7 @@ namespace panther{
 
 						if(get_pointer_to_value){
 							llvm::Type* llvm_type = llvmint::ptrcast<llvm::Type>(this->builder->getTypeBool());
-							llvm::AllocaInst* temporary_storage = this->builder->createAlloca(llvm_type, "temp_storage");
+							llvm::AllocaInst* temporary_storage = this->builder->createEntryBlockAlloca(llvm_type, "temp_storage");
 							this->builder->createStore(temporary_storage, temporary);
 
 							return llvmint::ptrcast<llvm::Value>(temporary_storage);
@@ -681,7 +865,7 @@ namespace panther{
 
 						if(get_pointer_to_value){
 							llvm::Type* llvm_type = llvmint::ptrcast<llvm::Type>(this->builder->getTypeInt());
-							llvm::AllocaInst* temporary_storage = this->builder->createAlloca(llvm_type, "temp_storage");
+							llvm::AllocaInst* temporary_storage = this->builder->createEntryBlockAlloca(llvm_type, "temp_storage");
 							this->builder->createStore(temporary_storage, temporary);
 
 							return llvmint::ptrcast<llvm::Value>(temporary_storage);
@@ -705,7 +889,7 @@ namespace panther{
 								return llvmint::ptrcast<llvm::Value>(var.llvm.global);
 							}
 						}else{
-							std::string load_name = std::format("{}.load", value.var.source.getToken(var.ident).value.string);
+							const std::string load_name = this->value_name("{}.load", value.var.source.getToken(var.ident).value.string);
 							if(var.is_alloca){
 								return llvmint::ptrcast<llvm::Value>(this->builder->createLoad(var.llvm.alloca, load_name));
 							}else{
@@ -723,15 +907,13 @@ namespace panther{
 
 						llvm::Type* param_type = this->get_type(this->src_manager->getType(param.type));
 
-
-						std::string load_addr_name = std::format("{}.loadAddr", this->source->getToken(param.ident).value.string);
-						llvm::LoadInst* load_addr = this->builder->createLoad(param.alloca, load_addr_name);
+						llvm::Value* param_ptr = this->get_param_pointer(param);
 
 						if(get_pointer_to_value){
-							return llvmint::ptrcast<llvm::Value>(load_addr);
+							return param_ptr;
 						}else{
-							std::string load_val_name = std::format("{}.loadVal", this->source->getToken(param.ident).value.string);
-							llvm::LoadInst* load_value = this->builder->createLoad(llvmint::ptrcast<llvm::Value>(load_addr), param_type, load_val_name);
+							const std::string load_val_name = this->value_name("{}.loadVal", this->source->getToken(param.ident).value.string);
+							llvm::LoadInst* load_value = this->builder->createLoad(param_ptr, param_type, load_val_name);
 
 							return llvmint::ptrcast<llvm::Value>(load_value);
 						}
@@ -747,12 +929,23 @@ namespace panther{
 							case PIR::FuncCall::Kind::Func: {
 								const PIR::Func& func = Source::getFunc(func_call.func);
 
+								const PIR::Type& pir_return_type = this->src_manager->getType(func.returnType.typeID());
+								return_type = this->get_type(pir_return_type);
+
+								if(func.returnsByPointer){
+									llvm::AllocaInst* alloca_val = this->builder->createEntryBlockAlloca(return_type, ".call.ret");
+									this->lower_func_call_into(func_call, llvmint::ptrcast<llvm::Value>(alloca_val));
+
+									if(get_pointer_to_value){
+										return llvmint::ptrcast<llvm::Value>(alloca_val);
+									}else{
+										return llvmint::ptrcast<llvm::Value>(this->builder->createLoad(alloca_val, ".call.ret.load"));
+									}
+								}
+
 								const std::vector<llvm::Value*> args = this->create_func_call_args(func_call);
 
 								return_value = llvmint::ptrcast<llvm::Value>(this->builder->createCall(func.llvmFunc, args, ".call"));
-
-								const PIR::Type& pir_return_type = this->src_manager->getType(func.returnType.typeID());
-								return_type = this->get_type(pir_return_type);
 							} break;
 
 							case PIR::FuncCall::Kind::Intrinsic: {
@@ -1414,7 +1607,7 @@ namespace panther{
 
 
 						if(get_pointer_to_value){
-							llvm::AllocaInst* alloca_val = this->builder->createAlloca(return_type, ".call.ret");
+							llvm::AllocaInst* alloca_val = this->builder->createEntryBlockAlloca(return_type, ".call.ret");
 							this->builder->createStore(alloca_val, return_value);
 							return llvmint::ptrcast<llvm::Value>(alloca_val);
 						}else{
@@ -1428,16 +1621,8 @@ namespace panther{
 
 						llvm::Type* initializer_llvm_type = this->get_type(initializer_type);
 
-						llvm::AllocaInst* init_alloca = this->builder->createAlloca(initializer_llvm_type, ".alloca.initializer");
-						for(size_t i = 0; i < initializer.memberVals.size(); i+=1){
-							if(initializer.memberVals[i].kind == PIR::Expr::Kind::None){ continue; } // skip {none} values
-
-							const std::string gep_name = std::format(".alloca.initializer.{}.GEP", i);
-
-							llvm::Value* gep_value = this->builder->createGEP(init_alloca, {0, int32_t(i)}, gep_name);
-							llvm::Value* member_value = this->get_value(initializer.memberVals[i]);
-							this->builder->createStore(gep_value, member_value);
-						}
+						llvm::AllocaInst* init_alloca = this->builder->createEntryBlockAlloca(initializer_llvm_type, ".alloca.initializer");
+						this->lower_value_into(value, llvmint::ptrcast<llvm::Value>(init_alloca));
 
 						if(get_pointer_to_value){
 							return llvmint::ptrcast<llvm::Value>(init_alloca);
@@ -1458,6 +1643,8 @@ namespace panther{
 							case Token::KeywordAddr: {
 								llvm::Value* llvm_value = nullptr;
 
+								this->set_param_may_be_captured(prefix.rhs);
+
 								if(prefix.rhs.kind == PIR::Expr::Kind::Var){
 									const PIR::Var& var = Source::getVar(prefix.rhs.var);
 									if(var.is_alloca){
@@ -1477,16 +1664,12 @@ namespace panther{
 									evo::debugAssert(prefix.rhs.kind == PIR::Expr::Kind::Param, "Unknown or unsupported rhs of [addr] stmt");
 
 									const PIR::Param& param = this->source->getParam(prefix.rhs.param);
-
-									std::string load_addr_name = std::format("{}.loadAddr", this->source->getToken(param.ident).value.string);
-									llvm::LoadInst* load_addr = this->builder->createLoad(param.alloca, load_addr_name);
-
-									llvm_value = llvmint::ptrcast<llvm::Value>(load_addr);
+									llvm_value = this->get_param_pointer(param);
 								}
 
 
 								if(get_pointer_to_value){
-									llvm::AllocaInst* temporary_storage = this->builder->createAlloca(
+									llvm::AllocaInst* temporary_storage = this->builder->createEntryBlockAlloca(
 										llvmint::ptrcast<llvm::Type>(this->builder->getTypePtr()), "temp_storage"
 									);
 									this->builder->createStore(temporary_storage, llvm_value);
@@ -1538,7 +1721,7 @@ namespace panther{
 
 						llvm::Value* lhs_value = this->get_value(accessor.lhs, true);
 						llvm::Type* lhs_llvm_type = this->get_type(lhs_type);
-						const std::string gep_name = std::format("{}.GEP", accessor.rhs);
+						const std::string gep_name = this->value_name("{}.GEP", accessor.rhs);
 
 						llvm::Value* gep_value = this->builder->createGEP(lhs_value, lhs_llvm_type, {0, member_index}, gep_name);
 
@@ -1547,7 +1730,7 @@ namespace panther{
 						}else{
 							const PIR::Type& member_type = this->src_manager->getType(*member_type_id);
 							llvm::Type* member_llvm_type = this->get_type(member_type);
-							const std::string load_name = std::format("{}.load", accessor.rhs);
+							const std::string load_name = this->value_name("{}.load", accessor.rhs);
 							return llvmint::ptrcast<llvm::Value>(this->builder->createLoad(gep_value, member_llvm_type, load_name));
 						}
 					} break;
@@ -1573,8 +1756,7 @@ namespace panther{
 
 					case PIR::Expr::Kind::Param: {
 						const PIR::Param& param = this->source->getParam(expr.param);
-						const std::string load_name = std::format("{}.load", this->source->getToken(param.ident).value.string);
-						return llvmint::ptrcast<llvm::Value>(this->builder->createLoad(param.alloca, load_name));
+						return this->get_param_pointer(param);
 					} break;
 
 
@@ -1603,7 +1785,7 @@ namespace panther{
 						llvm::Value* lhs_value = this->get_value(accessor.lhs, true);
 						llvm::Type* lhs_llvm_type = this->get_type(lhs_type);
 
-						return this->builder->createGEP(lhs_value, lhs_llvm_type, {0, member_index}, std::format("{}.GEP", accessor.rhs));
+						return this->builder->createGEP(lhs_value, lhs_llvm_type, {0, member_index}, this->value_name("{}.GEP", accessor.rhs));
 					} break;
 
 					default: evo::debugFatalBreak("Unknown or unsupported concrete expr kind");
@@ -1612,6 +1794,118 @@ namespace panther{
 
 
 
+			EVO_NODISCARD inline auto fits_in_registers(llvm::Type* type) const noexcept -> bool {
+				const uint64_t register_size = this->module->getTypeSize(llvmint::ptrcast<llvm::Type>(this->builder->getTypePtr()));
+				return this->module->getTypeSize(type) <= register_size * 2;
+			};
+
+			// read params that fit in 2 registers are passed by value instead of as a pointer
+			// 	so a read param may be a copy of the argument, and not see writes to the argument made during the call
+			// 	 (like the function writing to the global variable that was passed as the argument)
+			// 	the semantic analyzer rejects a read argument that aliases a write argument of the same call
+			// params whose address is taken are not passed by value as the copy would only live until the function returns
+			EVO_NODISCARD inline auto is_passed_by_value(const PIR::Param& param, llvm::Type* param_type) const noexcept -> bool {
+				if(param.kind != AST::FuncParams::Param::Kind::Read){ return false; }
+				if(param.isAddressTaken){ return false; }
+
+				return this->fits_in_registers(param_type);
+			};
+
+			// a param passed to a read param that has its address taken may have its address kept by the called function
+			// 	so its address is taken as well (repeated until nothing changes since calls can be recursive)
+			inline auto propagate_params_address_taken(std::vector<Source>& sources) noexcept -> void {
+				bool changed = true;
+				while(changed){
+					changed = false;
+
+					for(Source& source_ref : sources){
+						for(const PIR::FuncCall& func_call : source_ref.pir.func_calls){
+							if(func_call.kind != PIR::FuncCall::Kind::Func){ continue; }
+
+							const PIR::Func& func = Source::getFunc(func_call.func);
+
+							for(size_t i = 0; i < func_call.args.size(); i+=1){
+								const PIR::Param& param = func_call.func.source.getParam(func.params[i]);
+								if(param.kind != AST::FuncParams::Param::Kind::Read || param.isAddressTaken == false){ continue; }
+
+								const PIR::Expr* arg = &func_call.args[i];
+								while(arg->kind == PIR::Expr::Kind::Accessor){
+									arg = &source_ref.getAccessor(arg->accessor).lhs;
+								}
+
+								if(arg->kind != PIR::Expr::Kind::Param){ continue; }
+
+								PIR::Param& arg_param = source_ref.getParam(arg->param);
+								if(arg_param.isAddressTaken == false){
+									arg_param.isAddressTaken = true;
+									changed = true;
+								}
+							}
+						}
+					}
+				};
+			};
+
+			// structs that don't fit in 2 registers are returned by pointer
+			EVO_NODISCARD inline auto is_returned_by_pointer(const PIR::Func& func, llvm::Type* return_type) noexcept -> bool {
+				if(func.returnType.isVoid()){ return false; }
+				if(this->type_has_members(this->src_manager->getType(func.returnType.typeID())) == false){ return false; }
+
+				return this->fits_in_registers(return_type) == false;
+			};
+
+
+			EVO_NODISCARD inline auto get_param_pointer(const PIR::Param& param) noexcept -> llvm::Value* {
+				if(param.isPassedByValue){
+					return llvmint::ptrcast<llvm::Value>(param.alloca);
+				}
+
+				const std::string load_addr_name = this->value_name("{}.loadAddr", this->source->getToken(param.ident).value.string);
+				return llvmint::ptrcast<llvm::Value>(this->builder->createLoad(param.alloca, load_addr_name));
+			};
+
+
+			// if `expr` is a param (or a member of one), its pointer may outlive the function call
+			inline auto set_param_may_be_captured(const PIR::Expr& expr) noexcept -> void {
+				const PIR::Expr* param_expr = &expr;
+				while(param_expr->kind == PIR::Expr::Kind::Accessor){
+					param_expr = &this->source->getAccessor(param_expr->accessor).lhs;
+				}
+
+				if(param_expr->kind != PIR::Expr::Kind::Param){ return; }
+
+				this->source->getParam(param_expr->param).mayBeCaptured = true;
+			};
+
+
+
+
+
+
+			// each string is only added to the module once
+			// 	`name` is only used if the string isn't in the module yet
+			EVO_NODISCARD auto get_string_constant(std::string_view str, std::string_view name = "str") noexcept -> llvm::GlobalVariable* {
+				const auto find = this->string_constants.find(str);
+				if(find != this->string_constants.end()){
+					return find->second;
+				}
+
+				auto string = std::string(str);
+				llvm::GlobalVariable* string_constant = this->builder->valueString(*this->module, string, std::string(name));
+				this->string_constants.emplace(std::move(string), string_constant);
+
+				return string_constant;
+			};
+
+
+
+			// names of values are only formatted if the context keeps them (see llvmint::Context::setDiscardValueNames)
+			template<class... Args>
+			EVO_NODISCARD inline auto value_name(std::format_string<Args...> fmt, Args&&... args) const noexcept -> std::string {
+				if(this->discard_value_names){ return std::string(); }
+
+				return std::format(fmt, std::forward<Args>(args)...);
+			};
 
 
 
@@ -1682,8 +1976,23 @@ namespace panther{
 		private:
 			llvmint::IRBuilder* builder = nullptr;
 			llvmint::Module* module = nullptr;
+			llvmint::Context* context = nullptr;
+			llvmint::OptLevel opt_level = llvmint::OptLevel::O0;
+			bool discard_value_names = false;
 			PIR::Func* current_func = nullptr;
 
+			// so that string constants can be looked up with a std::string_view without creating a std::string
+			struct StringConstantHash{
+				using is_transparent = void;
+
+				EVO_NODISCARD auto operator()(std::string_view str) const noexcept -> size_t {
+					return std::hash<std::string_view>{}(str);
+				};
+			};
+
+			// string constants in the module (see get_string_constant())
+			std::unordered_map<std::string, llvm::GlobalVariable*, StringConstantHash, std::equal_to<>> string_constants{};
+
 			struct /* libc */ {
 				llvm::Function* puts = nullptr;
 				llvm::Function* printf = nullptr;
@@ -0,0 +1,220 @@
+#pragma once
+
+
+#include <Evo.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+
+namespace panther{
+
+
+	// Records how long things took as Chrome trace events (viewable in chrome://tracing or https://ui.perfetto.dev)
+	// 	when not enabled, a span only costs checking a flag
+	// 	header only since it's used by the frontend, the LLVM interface, and the driver
+	class Trace{
+		public:
+			using TimePoint = std::chrono::steady_clock::time_point;
+
+			// records the time from construction to destruction on the calling thread
+			class Span{
+				public:
+					Span(std::string_view name) noexcept : Span(name, []() noexcept -> std::string { return std::string(); }) {};
+
+					// `get_detail` is only called if tracing is enabled (so it's free to build a string)
+					template<class GetDetail>
+					Span(std::string_view name, GetDetail&& get_detail) noexcept {
+						if(Trace::isEnabled() == false){ return; }
+
+						this->recording.emplace(std::string(name), get_detail(), Trace::now());
+					};
+
+					~Span(){
+						if(this->recording.has_value() == false){ return; }
+
+						Trace::record(std::move(this->recording->name), std::move(this->recording->detail), this->recording->start, Trace::now());
+					};
+
+					Span(const Span&) = delete;
+					auto operator=(const Span&) = delete;
+
+				private:
+					struct Recording{
+						std::string name;
+						std::string detail;
+						TimePoint start;
+					};
+					std::optional<Recording> recording{};
+			};
+
+
+		public:
+			// must be called on the main thread before any of the threads that should be traced start
+			static auto enable() noexcept -> void {
+				// so that the main thread is the first thread
+				[[maybe_unused]] const ThreadEvents& main_thread_events = Trace::get_thread_events();
+
+				Trace::enable_time = Trace::now();
+				Trace::is_enabled.store(true, std::memory_order_release);
+			};
+
+			EVO_NODISCARD static auto isEnabled() noexcept -> bool {
+				return Trace::is_enabled.load(std::memory_order_relaxed);
+			};
+
+			EVO_NODISCARD static auto now() noexcept -> TimePoint { return std::chrono::steady_clock::now(); };
+
+
+			// records a span that already ended (on the calling thread)
+			static auto record(std::string&& name, std::string&& detail, TimePoint start, TimePoint end) noexcept -> void {
+				if(Trace::isEnabled() == false){ return; }
+
+				Trace::get_thread_events().events.emplace_back(std::move(name), std::move(detail), start, end);
+			};
+
+
+			// removes every recorded event (like between compiles of a server) and restarts the time from 0
+			// 	every thread must be done recording
+			static auto clear() noexcept -> void {
+				State& state = Trace::get_state();
+				const auto lock = std::scoped_lock(state.mutex);
+
+				std::erase_if(state.threads, [](const std::unique_ptr<ThreadEvents>& thread_events) noexcept -> bool {
+					return thread_events->hasExited;
+				});
+
+				for(uint32_t i = 0; i < uint32_t(state.threads.size()); i+=1){
+					state.threads[i]->threadIndex = i;
+					state.threads[i]->events.clear();
+				}
+
+				Trace::enable_time = Trace::now();
+			};
+
+
+			// in the Chrome trace event format
+			// 	every thread must be done recording
+			EVO_NODISCARD static auto printJSON() noexcept -> std::string {
+				State& state = Trace::get_state();
+				const auto lock = std::scoped_lock(state.mutex);
+
+				const auto to_micros = [](TimePoint time_point) noexcept -> double {
+					return std::chrono::duration<double, std::micro>(time_point - Trace::enable_time).count();
+				};
+
+				auto output = std::string("{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+				bool is_first_event = true;
+
+				for(const std::unique_ptr<ThreadEvents>& thread_events : state.threads){
+					output += std::format(
+						"{}\t{{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": {}, \"args\": {{\"name\": \"{}\"}}}}",
+						is_first_event ? "" : ",\n",
+						thread_events->threadIndex,
+						thread_events->threadIndex == 0 ? "main" : std::format("worker {}", thread_events->threadIndex)
+					);
+					is_first_event = false;
+
+					for(const Event& event : thread_events->events){
+						output += std::format(
+							",\n\t{{\"name\": \"{}\", \"cat\": \"panther\", \"ph\": \"X\", \"pid\": 1, \"tid\": {}, "
+							"\"ts\": {:.3f}, \"dur\": {:.3f}, \"args\": {{\"detail\": \"{}\"}}}}",
+							Trace::escape(event.name),
+							thread_events->threadIndex,
+							to_micros(event.start),
+							std::chrono::duration<double, std::micro>(event.end - event.start).count(),
+							Trace::escape(event.detail)
+						);
+					}
+				}
+
+				output += "\n]}\n";
+
+				return output;
+			};
+
+
+		private:
+			struct Event{
+				std::string name;
+				std::string detail;
+				TimePoint start;
+				TimePoint end;
+			};
+
+			// only written to by its own thread, so no lock is needed to record
+			struct ThreadEvents{
+				uint32_t threadIndex;
+				std::vector<Event> events{};
+				bool hasExited = false; // set under the lock of the state
+			};
+
+			struct State{
+				std::vector<std::unique_ptr<ThreadEvents>> threads{};
+				std::mutex mutex{};
+			};
+
+			EVO_NODISCARD static auto get_state() noexcept -> State& {
+				static auto state = State();
+				return state;
+			};
+
+			// the events are kept after the thread exits (owned by the state)
+			EVO_NODISCARD static auto get_thread_events() noexcept -> ThreadEvents& {
+				// marks the events of the thread as exited so that clear() can remove them
+				struct ThreadEventsOwner{
+					ThreadEvents* thread_events = nullptr;
+
+					~ThreadEventsOwner(){
+						if(this->thread_events == nullptr){ return; }
+
+						State& state = Trace::get_state();
+						const auto lock = std::scoped_lock(state.mutex);
+						this->thread_events->hasExited = true;
+					};
+				};
+				thread_local ThreadEventsOwner owner{};
+
+				if(owner.thread_events == nullptr){
+					State& state = Trace::get_state();
+					const auto lock = std::scoped_lock(state.mutex);
+
+					owner.thread_events = state.threads.emplace_back(
+						std::make_unique<ThreadEvents>(uint32_t(state.threads.size()))
+					).get();
+				}
+
+				return *owner.thread_events;
+			};
+
+
+			EVO_NODISCARD static auto escape(std::string_view str) noexcept -> std::string {
+				auto escaped = std::string();
+				escaped.reserve(str.size());
+
+				for(char character : str){
+					switch(character){
+						break; case '"':  escaped += "\\\"";
+						break; case '\\': escaped += "\\\\";
+						break; default: {
+							if(uint8_t(character) < 0x20){
+								escaped += std::format("\\u{:04x}", uint8_t(character));
+							}else{
+								escaped += character;
+							}
+						}
+					};
+				}
+
+				return escaped;
+			};
+
+		private:
+			static inline std::atomic<bool> is_enabled = false;
+			static inline TimePoint enable_time{};
+	};
+
+
+};
@@ -3,9 +3,14 @@
 
 #include <Evo.h>
 
+#include <span>
+
 namespace panther{
 	namespace AST{
 
+		// Child lists of nodes (attributes, block statements, arguments, etc.) point into the arena of the source
+		// 	that the nodes belong to
+
 		enum class Kind{
 			VarDecl,
 			TemplatePack,
@@ -60,7 +65,7 @@ namespace panther{
 		struct VarDecl{
 			bool isDef;
 			Node::ID ident;
-			std::vector<Token::ID> attributes;
+			std::span<const Token::ID> attributes;
 			std::optional<Node::ID> type;
 			std::optional<Node::ID> expr;
 		};
@@ -81,7 +86,7 @@ namespace panther{
 				Template(Node::ID _ident, Token::ID _keyword) noexcept : ident(_ident), isTypeKeyword(true),  keyword(_keyword) {};
 			};
 
-			std::vector<Template> templates;
+			std::span<const Template> templates;
 		};
 
 
@@ -99,7 +104,7 @@ namespace panther{
 				} kind;
 			};
 
-			std::vector<Param> params;
+			std::span<const Param> params;
 		};
 
 		struct Func{
@@ -107,7 +112,7 @@ namespace panther{
 
 			std::optional<Node::ID> templatePack;
 			Node::ID params;
-			std::vector<Token::ID> attributes;
+			std::span<const Token::ID> attributes;
 			Node::ID returnType;
 			
 			Node::ID block;
@@ -116,7 +121,7 @@ namespace panther{
 		struct Struct{
 			Node::ID ident;
 			std::optional<Node::ID> templatePack;
-			std::vector<Token::ID> attributes;
+			std::span<const Token::ID> attributes;
 			Node::ID block;
 		};
 
@@ -135,7 +140,7 @@ namespace panther{
 
 		struct Alias{
 			Node::ID ident;
-			std::vector<Token::ID> attributes;
+			std::span<const Token::ID> attributes;
 			Node::ID type;
 		};
 
@@ -152,14 +157,14 @@ namespace panther{
 				bool isPtr;
 				bool isConst;
 			};
-			std::vector<Qualifier> qualifiers;
+			std::span<const Qualifier> qualifiers;
 		};
 
 
 
 
 		struct Block{
-			std::vector<Node::ID> nodes;
+			std::span<const Node::ID> nodes;
 		};
 	
 
@@ -182,12 +187,12 @@ namespace panther{
 
 		struct TemplatedExpr{
 			Node::ID expr;
-			std::vector<Node::ID> templateArgs;
+			std::span<const Node::ID> templateArgs;
 		};
 
 		struct FuncCall{
 			Node::ID target;
-			std::vector<Node::ID> args;
+			std::span<const Node::ID> args;
 		};
 
 		struct Initializer{
@@ -197,7 +202,7 @@ namespace panther{
 				Node::ID ident;
 				Node::ID value;
 			};
-			std::vector<Member> members;
+			std::span<const Member> members;
 		};
 
 
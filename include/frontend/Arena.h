@@ -0,0 +1,105 @@
+#pragma once
+
+
+#include <Evo.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace panther{
+
+
+	// Bump allocator. Memory is only freed all at once when the arena is destroyed, so only types that don't need
+	// 	to be destructed can be allocated
+	// Not thread-safe
+	class Arena{
+		private:
+			static constexpr size_t FIRST_BLOCK_SIZE = 1 << 14;
+			static constexpr size_t MAX_BLOCK_SIZE = 1 << 20;
+
+		public:
+			Arena() noexcept = default;
+			~Arena() = default;
+
+			Arena(const Arena&) = delete;
+			auto operator=(const Arena&) = delete;
+
+			Arena(Arena&& rhs) noexcept
+				: blocks(std::move(rhs.blocks)),
+				cursor(std::exchange(rhs.cursor, nullptr)),
+				block_end(std::exchange(rhs.block_end, nullptr)),
+				next_block_size(std::exchange(rhs.next_block_size, FIRST_BLOCK_SIZE)) {};
+
+			auto operator=(Arena&& rhs) noexcept -> Arena& {
+				this->blocks = std::move(rhs.blocks);
+				this->cursor = std::exchange(rhs.cursor, nullptr);
+				this->block_end = std::exchange(rhs.block_end, nullptr);
+				this->next_block_size = std::exchange(rhs.next_block_size, FIRST_BLOCK_SIZE);
+				return *this;
+			};
+
+
+			template<class T>
+			EVO_NODISCARD auto allocate(size_t count) noexcept -> T* {
+				static_assert(std::is_trivially_destructible_v<T>, "Arena cannot destruct allocated objects");
+
+				const size_t num_bytes = sizeof(T) * count;
+
+				// aligning can move the cursor past the end of the block (if the previous allocation filled it exactly)
+				std::byte* aligned_cursor = align(this->cursor, alignof(T));
+				if(
+					this->cursor == nullptr || aligned_cursor > this->block_end ||
+					size_t(this->block_end - aligned_cursor) < num_bytes
+				){
+					this->add_block(num_bytes);
+					aligned_cursor = this->cursor;
+				}
+
+				this->cursor = aligned_cursor + num_bytes;
+				return reinterpret_cast<T*>(aligned_cursor);
+			};
+
+
+			// copies `elems` into the arena
+			template<class T>
+			EVO_NODISCARD auto copy(std::span<const T> elems) noexcept -> std::span<const T> {
+				static_assert(std::is_trivially_copyable_v<T>, "Arena can only copy trivially copyable types");
+
+				if(elems.empty()){ return std::span<const T>(); }
+
+				T* copied_elems = this->allocate<T>(elems.size());
+				std::memcpy(copied_elems, elems.data(), sizeof(T) * elems.size());
+				return std::span<const T>(copied_elems, elems.size());
+			};
+
+
+		private:
+			EVO_NODISCARD static auto align(std::byte* ptr, size_t alignment) noexcept -> std::byte* {
+				const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+				return reinterpret_cast<std::byte*>((address + alignment - 1) & ~(alignment - 1));
+			};
+
+			// blocks are allocated with operator new, so they are aligned enough for anything put in the arena
+			auto add_block(size_t min_size) noexcept -> void {
+				const size_t block_size = std::max(this->next_block_size, min_size);
+
+				this->blocks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(block_size));
+				this->cursor = this->blocks.back().get();
+				this->block_end = this->cursor + block_size;
+
+				this->next_block_size = std::min(this->next_block_size * 2, MAX_BLOCK_SIZE);
+			};
+
+		private:
+			std::vector<std::unique_ptr<std::byte[]>> blocks{};
+			std::byte* cursor = nullptr;
+			std::byte* block_end = nullptr;
+			size_t next_block_size = FIRST_BLOCK_SIZE;
+	};
+
+
+};
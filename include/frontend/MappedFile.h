@@ -0,0 +1,47 @@
+#pragma once
+
+
+#include <Evo.h>
+
+#include <filesystem>
+
+namespace panther{
+
+
+	// Read-only memory mapping of a file
+	// 	Used so that sources can be tokenized directly from the file without copying it into memory first
+	class MappedFile{
+		public:
+			MappedFile() noexcept = default;
+			~MappedFile() noexcept { this->close(); };
+
+			MappedFile(const MappedFile&) = delete;
+			auto operator=(const MappedFile&) = delete;
+
+			MappedFile(MappedFile&& rhs) noexcept;
+			auto operator=(MappedFile&& rhs) noexcept -> MappedFile&;
+
+
+			// returns true if successful
+			EVO_NODISCARD auto open(const std::filesystem::path& path) noexcept -> bool;
+			auto close() noexcept -> void;
+
+			EVO_NODISCARD inline auto isOpen() const noexcept -> bool { return this->is_open; };
+
+			EVO_NODISCARD inline auto getData() const noexcept -> std::string_view {
+				return std::string_view(this->data, this->data_size);
+			};
+
+
+		private:
+			const char* data = nullptr;
+			size_t data_size = 0;
+			bool is_open = false;
+
+			#if defined(EVO_PLATFORM_WINDOWS)
+				void* mapping_handle = nullptr;
+			#endif
+	};
+
+
+};
@@ -454,6 +454,9 @@ namespace panther{
 			AST::FuncParams::Param::Kind kind;
 
 			llvm::AllocaInst* alloca = nullptr;
+			bool isPassedByValue = false; // if false, the param is passed as a pointer to the value
+			bool mayBeCaptured = false; // if the pointer to the value may outlive the function call
+			bool isAddressTaken = false; // if [addr] is used on the param (or a member of it), so it can't be passed by value
 			bool mayHaveBeenEdited = false; // it's impossible to detech this 100%
 		};
 
@@ -590,6 +593,7 @@ namespace panther{
 			
 
 			llvm::Function* llvmFunc = nullptr;
+			bool returnsByPointer = false; // if the return value is written to a pointer passed as the first argument (sret)
 			StmtBlock stmts{};
 			bool terminatesInBaseScope = false;
 		};
@@ -788,4 +792,16 @@ struct std::hash<panther::PIR::Type::ID>{
 	auto operator()(const panther::PIR::Type::ID& id) const noexcept -> size_t {
 		return std::hash<uint32_t>{}(id.id);
 	};
-};
\ No newline at end of file
+};
+
+// Hashes are consistent with the operator== of the types (used for interning in SourceManager)
+
+template<>
+struct std::hash<panther::PIR::BaseType>{
+	auto operator()(const panther::PIR::BaseType& base_type) const noexcept -> size_t;
+};
+
+template<>
+struct std::hash<panther::PIR::Type>{
+	auto operator()(const panther::PIR::Type& type) const noexcept -> size_t;
+};
@@ -0,0 +1,160 @@
+#pragma once
+
+
+#include <Evo.h>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <memory>
+
+namespace panther{
+
+
+	// Vector that never moves elements once they are created. Elements are stored in segments that double in size,
+	// 	so getting an element by index is safe while another thread is adding new elements
+	// 	(as long as the index was gotten in a thread-safe manner)
+	// Adding elements is not thread-safe and requires external synchronization
+	template<class T>
+	class SegmentedVector{
+		private:
+			static constexpr size_t FIRST_SEGMENT_SIZE_LOG2 = 5;
+			static constexpr size_t FIRST_SEGMENT_SIZE = size_t(1) << FIRST_SEGMENT_SIZE_LOG2;
+			static constexpr size_t MAX_SEGMENTS = 64 - FIRST_SEGMENT_SIZE_LOG2;
+
+		public:
+			SegmentedVector() noexcept = default;
+			~SegmentedVector() noexcept { this->clear(); };
+
+			SegmentedVector(const SegmentedVector& rhs) noexcept {
+				for(size_t i = 0; i < rhs.size(); i+=1){
+					this->emplace_back(rhs[i]);
+				}
+			};
+
+			SegmentedVector(SegmentedVector&& rhs) noexcept : segments(rhs.segments), num_elems(rhs.size()) {
+				rhs.segments.fill(nullptr);
+				rhs.num_elems.store(0, std::memory_order_relaxed);
+			};
+
+			auto operator=(const SegmentedVector& rhs) = delete;
+			auto operator=(SegmentedVector&& rhs) = delete;
+
+
+			auto emplace_back(auto&&... args) noexcept -> T& {
+				const size_t index = this->size();
+				const SegmentLocation location = get_location(index);
+
+				if(location.offset == 0 && this->segments[location.segment] == nullptr){
+					this->segments[location.segment] = std::allocator<T>().allocate(get_segment_size(location.segment));
+				}
+
+				T* elem = std::construct_at(&this->segments[location.segment][location.offset], std::forward<decltype(args)>(args)...);
+				this->num_elems.store(index + 1, std::memory_order_release);
+
+				return *elem;
+			};
+
+
+			auto clear() noexcept -> void {
+				for(size_t i = 0; i < this->size(); i+=1){
+					std::destroy_at(&(*this)[i]);
+				}
+
+				for(size_t i = 0; i < this->segments.size(); i+=1){
+					if(this->segments[i] == nullptr){ break; }
+
+					std::allocator<T>().deallocate(this->segments[i], get_segment_size(i));
+					this->segments[i] = nullptr;
+				}
+
+				this->num_elems.store(0, std::memory_order_relaxed);
+			};
+
+
+			EVO_NODISCARD inline auto operator[](size_t index) const noexcept -> const T& {
+				evo::debugAssert(index < this->size(), "SegmentedVector index out of bounds");
+				const SegmentLocation location = get_location(index);
+				return this->segments[location.segment][location.offset];
+			};
+
+			EVO_NODISCARD inline auto operator[](size_t index) noexcept -> T& {
+				evo::debugAssert(index < this->size(), "SegmentedVector index out of bounds");
+				const SegmentLocation location = get_location(index);
+				return this->segments[location.segment][location.offset];
+			};
+
+			EVO_NODISCARD inline auto back() const noexcept -> const T& { return (*this)[this->size() - 1]; };
+			EVO_NODISCARD inline auto back()       noexcept ->       T& { return (*this)[this->size() - 1]; };
+
+			EVO_NODISCARD inline auto size() const noexcept -> size_t { return this->num_elems.load(std::memory_order_acquire); };
+			EVO_NODISCARD inline auto empty() const noexcept -> bool { return this->size() == 0; };
+
+
+
+			///////////////////////////////////
+			// iterators
+
+			template<bool IS_CONST>
+			class IteratorImpl{
+				public:
+					using VecPtr = std::conditional_t<IS_CONST, const SegmentedVector*, SegmentedVector*>;
+					using Ref = std::conditional_t<IS_CONST, const T&, T&>;
+					using Ptr = std::conditional_t<IS_CONST, const T*, T*>;
+
+				public:
+					IteratorImpl(VecPtr _vec, size_t _index) noexcept : vec(_vec), index(_index) {};
+
+					auto operator++() noexcept -> IteratorImpl& {
+						this->index += 1;
+						return *this;
+					};
+
+					EVO_NODISCARD auto operator*() const noexcept -> Ref { return (*this->vec)[this->index]; };
+					EVO_NODISCARD auto operator->() const noexcept -> Ptr { return &(*this->vec)[this->index]; };
+
+					EVO_NODISCARD auto operator==(const IteratorImpl& rhs) const noexcept -> bool {
+						return this->vec == rhs.vec && this->index == rhs.index;
+					};
+
+				private:
+					VecPtr vec;
+					size_t index;
+			};
+
+			using Iterator = IteratorImpl<false>;
+			using ConstIterator = IteratorImpl<true>;
+
+			EVO_NODISCARD auto begin()       noexcept ->      Iterator { return Iterator(this, 0); };
+			EVO_NODISCARD auto begin() const noexcept -> ConstIterator { return ConstIterator(this, 0); };
+
+			EVO_NODISCARD auto end()       noexcept ->      Iterator { return Iterator(this, this->size()); };
+			EVO_NODISCARD auto end() const noexcept -> ConstIterator { return ConstIterator(this, this->size()); };
+
+
+		private:
+			struct SegmentLocation{
+				size_t segment;
+				size_t offset;
+			};
+
+			// segment n starts at index (FIRST_SEGMENT_SIZE * (2^n - 1)) and has (FIRST_SEGMENT_SIZE * 2^n) elements
+			EVO_NODISCARD static constexpr auto get_location(size_t index) noexcept -> SegmentLocation {
+				const size_t adjusted_index = index + FIRST_SEGMENT_SIZE;
+				const size_t segment = size_t(std::bit_width(adjusted_index)) - 1 - FIRST_SEGMENT_SIZE_LOG2;
+
+				return SegmentLocation(segment, adjusted_index - (size_t(1) << (segment + FIRST_SEGMENT_SIZE_LOG2)));
+			};
+
+			EVO_NODISCARD static constexpr auto get_segment_size(size_t segment) noexcept -> size_t {
+				return FIRST_SEGMENT_SIZE << segment;
+			};
+
+
+		private:
+			std::array<T*, MAX_SEGMENTS> segments{};
+			std::atomic<size_t> num_elems = 0;
+	};
+
+
+};
@@ -9,9 +9,15 @@
 #include "./AST.h"
 #include "Message.h"
 #include "PIR.h"
+#include "SegmentedVector.h"
+#include "Arena.h"
+#include "MappedFile.h"
 
 #include <filesystem>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
+#include <variant>
 
 namespace panther{
 
@@ -32,16 +38,28 @@ namespace panther{
 			Source(std::filesystem::path&& src_path, std::string&& src_data, const Config& _config, class SourceManager& src_manager, ID id) noexcept
 				: src_location(std::move(src_path)), data(std::move(src_data)), config(_config), source_manager(src_manager), src_id(id) {};
 
+			Source(std::filesystem::path&& src_path, MappedFile&& src_data, const Config& _config, class SourceManager& src_manager, ID id) noexcept
+				: src_location(std::move(src_path)), data(std::move(src_data)), config(_config), source_manager(src_manager), src_id(id) {
+				evo::debugAssert(std::get<MappedFile>(this->data).isOpen(), "MappedFile of source is not open");
+			};
+
 			~Source() noexcept {
 				for(std::string* str_ptr : this->string_literal_values){
 					delete str_ptr;
 				}
 			};
 
+			// MappedFile can't be copied
+			Source(const Source&) = delete;
+			Source(Source&&) noexcept = default;
+
 
 
 			EVO_NODISCARD inline auto getLocation() const noexcept -> const std::filesystem::path& { return this->src_location; };
-			EVO_NODISCARD inline auto getData() const noexcept -> const std::string& { return this->data; };
+			EVO_NODISCARD inline auto getData() const noexcept -> std::string_view {
+				if(std::holds_alternative<MappedFile>(this->data)){ return std::get<MappedFile>(this->data).getData(); }
+				return std::get<std::string>(this->data);
+			};
 			EVO_NODISCARD inline auto getConfig() const noexcept -> const Config& { return this->config; };
 			EVO_NODISCARD inline auto getSourceManager() noexcept -> SourceManager& { return this->source_manager; };
 			EVO_NODISCARD inline auto getSourceManager() const noexcept -> const SourceManager& { return this->source_manager; };
@@ -53,6 +71,45 @@ namespace panther{
 			// returns true if successful (no errors)
 			EVO_NODISCARD auto parse() noexcept -> bool;
 
+
+			// everything made by tokenizing and parsing
+			struct TokensAndAST{
+				std::vector<uint32_t> lineStarts;
+				std::vector<Token::Packed> tokens;
+				std::vector<Token::Payload> tokenPayloads;
+				std::vector<std::unique_ptr<std::string>> stringLiteralValues;
+
+				std::vector<AST::Node::ID> globalStmts;
+				std::vector<AST::Node> nodes;
+				std::vector<AST::VarDecl> varDecls;
+				std::vector<AST::Func> funcs;
+				std::vector<AST::Struct> structs;
+				std::vector<AST::TemplatePack> templatePacks;
+				std::vector<AST::FuncParams> funcParams;
+				std::vector<AST::Conditional> conditionals;
+				std::vector<AST::Alias> aliases;
+				std::vector<AST::Return> returns;
+				std::vector<AST::Prefix> prefixes;
+				std::vector<AST::Infix> infixes;
+				std::vector<AST::Postfix> postfixes;
+				std::vector<AST::TemplatedExpr> templatedExprs;
+				std::vector<AST::FuncCall> funcCalls;
+				std::vector<AST::Initializer> initializers;
+				std::vector<AST::Type> types;
+				std::vector<AST::Block> blocks;
+
+				Arena astArena;
+			};
+
+			// moves out the tokens and AST so that they can be used by a source with the same data
+			// 	(tokens refer to the data by offset, so the data must be exactly the same)
+			// 	the source must have been tokenized and parsed successfully, and must not be used after
+			EVO_NODISCARD auto extractTokensAndAST() noexcept -> TokensAndAST;
+
+			// used instead of tokenizing and parsing (tokenize() and parse() do nothing after)
+			// 	must be called before tokenize()
+			auto setTokensAndAST(TokensAndAST&& tokens_and_ast) noexcept -> void;
+
 			// returns true if successful (no errors)
 			EVO_NODISCARD auto semantic_analysis_global_idents_and_imports() noexcept -> bool;
 			EVO_NODISCARD auto semantic_analysis_global_aliases() noexcept -> bool;
@@ -68,7 +125,16 @@ namespace panther{
 			// AST
 
 			EVO_NODISCARD auto getNode(AST::Node::ID node_id) const noexcept -> const AST::Node&;
-			EVO_NODISCARD auto getToken(Token::ID token_id) const noexcept -> const Token&;
+			EVO_NODISCARD auto getToken(Token::ID token_id) const noexcept -> Token;
+			EVO_NODISCARD inline auto getTokenKind(Token::ID token_id) const noexcept -> Token::Kind {
+				return this->tokens[token_id.id].getKind();
+			};
+
+			// Line / collumn information is computed from the line starts found when tokenizing
+			EVO_NODISCARD auto getTokenLocation(Token::ID token_id) const noexcept -> Location;
+			EVO_NODISCARD auto getTokenLocation(const Token& token) const noexcept -> Location;
+			EVO_NODISCARD auto getOffsetLocation(uint32_t offset) const noexcept -> Location; // location of a single char
+			EVO_NODISCARD auto getLineOffset(uint32_t line) const noexcept -> uint32_t; // offset of the start of the line
 
 
 			EVO_NODISCARD auto getVarDecl(AST::Node::ID node_id) const noexcept -> const AST::VarDecl&;
@@ -121,20 +187,20 @@ namespace panther{
 			EVO_NODISCARD auto getInitializer(const AST::Node& node) const noexcept -> const AST::Initializer&;
 
 
-			EVO_NODISCARD auto getLiteral(AST::Node::ID node_id) const noexcept -> const Token&;
-			EVO_NODISCARD auto getLiteral(const AST::Node& node) const noexcept -> const Token&;
+			EVO_NODISCARD auto getLiteral(AST::Node::ID node_id) const noexcept -> Token;
+			EVO_NODISCARD auto getLiteral(const AST::Node& node) const noexcept -> Token;
 
-			EVO_NODISCARD auto getIdent(AST::Node::ID node_id) const noexcept -> const Token&;
-			EVO_NODISCARD auto getIdent(const AST::Node& node) const noexcept -> const Token&;
+			EVO_NODISCARD auto getIdent(AST::Node::ID node_id) const noexcept -> Token;
+			EVO_NODISCARD auto getIdent(const AST::Node& node) const noexcept -> Token;
 
-			EVO_NODISCARD auto getIntrinsic(AST::Node::ID node_id) const noexcept -> const Token&;
-			EVO_NODISCARD auto getIntrinsic(const AST::Node& node) const noexcept -> const Token&;
+			EVO_NODISCARD auto getIntrinsic(AST::Node::ID node_id) const noexcept -> Token;
+			EVO_NODISCARD auto getIntrinsic(const AST::Node& node) const noexcept -> Token;
 
-			EVO_NODISCARD auto getUninit(AST::Node::ID node_id) const noexcept -> const Token&;
-			EVO_NODISCARD auto getUninit(const AST::Node& node) const noexcept -> const Token&;
+			EVO_NODISCARD auto getUninit(AST::Node::ID node_id) const noexcept -> Token;
+			EVO_NODISCARD auto getUninit(const AST::Node& node) const noexcept -> Token;
 
-			EVO_NODISCARD auto getUnreachable(AST::Node::ID node_id) const noexcept -> const Token&;
-			EVO_NODISCARD auto getUnreachable(const AST::Node& node) const noexcept -> const Token&;
+			EVO_NODISCARD auto getUnreachable(AST::Node::ID node_id) const noexcept -> Token;
+			EVO_NODISCARD auto getUnreachable(const AST::Node& node) const noexcept -> Token;
 
 
 
@@ -327,8 +393,15 @@ namespace panther{
 				this->pir.pub_vars.emplace(ident, id);
 			};
 			inline auto addPublicStruct(std::string_view ident, PIR::Struct::ID id) noexcept -> void {
+				const auto lock = std::unique_lock(*this->pir.pub_structs_mutex);
 				this->pir.pub_structs.emplace(ident, id);
 			};
+			EVO_NODISCARD inline auto getPublicStruct(std::string_view ident) const noexcept -> std::optional<PIR::Struct::ID> {
+				const auto lock = std::shared_lock(*this->pir.pub_structs_mutex);
+				const auto pub_struct_iter = this->pir.pub_structs.find(ident);
+				if(pub_struct_iter == this->pir.pub_structs.end()){ return std::nullopt; }
+				return pub_struct_iter->second;
+			};
 			inline auto addPublicImport(std::string_view ident, Source::ID id) noexcept -> void {
 				this->pir.pub_imports.emplace(ident, id);
 			};
@@ -341,6 +414,7 @@ namespace panther{
 
 			auto fatal(const std::string& msg, uint32_t line, uint32_t collumn) noexcept -> void;
 			auto fatal(const std::string& msg, uint32_t line, uint32_t collumn_start, uint32_t collumn_end) noexcept -> void;
+			auto fatal(const std::string& msg, Location location) noexcept -> void;
 
 
 			auto error(const std::string& msg, uint32_t line, uint32_t collumn, std::vector<Message::Info>&& infos = {}) noexcept -> void;
@@ -363,7 +437,8 @@ namespace panther{
 			EVO_NODISCARD inline auto hasErrored() const noexcept -> bool { return this->has_errored; };
 
 		public:
-			std::vector<Token> tokens{};
+			std::vector<Token::Packed> tokens{};
+			std::vector<Token::Payload> token_payloads{};
 			std::vector<std::string*> string_literal_values{}; // using raw pointers because for some reason it causes an error
 
 			std::vector<AST::Node::ID> global_stmts{};
@@ -385,13 +460,17 @@ namespace panther{
 			std::vector<AST::Type> types{};
 			std::vector<AST::Block> blocks{};
 
+			Arena ast_arena{}; // child lists of AST nodes
+
 
 
 			struct /* pir */ {
-				std::vector<PIR::Var> vars{};
+				// vars and structs can be looked up by other sources while this source is still adding to them
+				// 	(analyzing function bodies is multithreaded), so their elements must never move
+				SegmentedVector<PIR::Var> vars{};
 				std::vector<PIR::Param> params{};
 				std::vector<PIR::Func> funcs{};
-				std::vector<PIR::Struct> structs{};
+				SegmentedVector<PIR::Struct> structs{};
 				std::vector<PIR::Conditional> conditionals{};
 				std::vector<PIR::Return> returns{};
 				std::vector<PIR::Assignment> assignments{};
@@ -406,6 +485,9 @@ namespace panther{
 				std::unordered_map<std::string_view, std::vector<PIR::Func::ID>> pub_funcs{};
 				std::unordered_map<std::string_view, PIR::Var::ID> pub_vars{};
 				std::unordered_map<std::string_view, PIR::Struct::ID> pub_structs{};
+				// instances of public template structs are added while analyzing function bodies
+				// 	(pointer because Source must be movable)
+				std::unique_ptr<std::shared_mutex> pub_structs_mutex = std::make_unique<std::shared_mutex>();
 				std::unordered_map<std::string_view, Source::ID> pub_imports{};
 				std::unordered_map<std::string_view, PIR::Type::VoidableID> pub_aliases{};
 			} pir;
@@ -415,15 +497,24 @@ namespace panther{
 			EVO_NODISCARD auto get_node_location(AST::Node::ID node_id) const noexcept -> Location;
 			EVO_NODISCARD auto get_node_location(const AST::Node& node) const noexcept -> Location;
 
+			// line and collumn of the position in the source data at `offset` (both start at 1)
+			struct LineAndCollumn{
+				uint32_t line;
+				uint32_t collumn;
+			};
+			EVO_NODISCARD auto get_line_and_collumn(uint32_t offset) const noexcept -> LineAndCollumn;
+
 
 		private:
 			std::filesystem::path src_location;
-			std::string data;
+			std::variant<std::string, MappedFile> data; // MappedFile if the file is loaded without copying
+			std::vector<uint32_t> line_starts{}; // offset of the beginning of each line (set when tokenizing)
 			const Config& config;
 			ID src_id;
 			class SourceManager& source_manager;
 
 			bool has_errored = false;
+			bool has_set_tokens_and_ast = false;
 
 			class SemanticAnalyzer* semantic_analyzer = nullptr;
 	};
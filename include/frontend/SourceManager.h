@@ -7,10 +7,13 @@
 #include "Source.h"
 #include "PIR.h"
 #include "Message.h"
+#include "SegmentedVector.h"
 
 #include <functional>
 #include <filesystem>
 #include <unordered_set>
+#include <unordered_map>
+#include <mutex>
 
 namespace panther{
 
@@ -26,6 +29,10 @@ namespace panther{
 
 			struct Config{
 				std::string basePath;
+
+				// number of threads used for per-source work (tokenizing, parsing, analyzing function bodies)
+				// 	0 means use the number of hardware threads, 1 means run everything on the calling thread
+				evo::uint numThreads = 1;
 			};
 
 			enum class GetSourceIDError{
@@ -48,11 +55,8 @@ namespace panther{
 			// The purpose of locking is to make sure no sources are added after doing things like tokenizing
 			// 	this is to ensure that pointers/references still point to the right place
 
-			EVO_NODISCARD inline auto lock() noexcept -> void {
-				evo::debugAssert(this->is_locked == false, "SourceManager is already locked");
-
-				this->is_locked = true;
-			};
+			// every reserved source ID must have had its source added before locking
+			auto lock() noexcept -> void;
 
 			EVO_NODISCARD inline auto isLocked() const noexcept -> bool { return this->is_locked; };
 
@@ -62,6 +66,18 @@ namespace panther{
 
 			// TODO: other permutations of refs
 			EVO_NODISCARD auto addSource(std::filesystem::path&& location, std::string&& data, const Source::Config& src_config) noexcept -> Source::ID;
+			EVO_NODISCARD auto addSource(std::filesystem::path&& location, MappedFile&& data, const Source::Config& src_config) noexcept -> Source::ID;
+
+			// Reserves `num_sources` consecutive source IDs and returns the first one.
+			// 	This allows sources to be added from multiple threads (in any order) while still having IDs that
+			// 	don't depend on which source finished loading first
+			// Thread-safe
+			EVO_NODISCARD auto reserveSourceIDs(uint32_t num_sources) noexcept -> Source::ID;
+
+			// adds a source with an ID gotten from `reserveSourceIDs()`
+			// Thread-safe
+			auto addSource(Source::ID id, std::filesystem::path&& location, std::string&& data, const Source::Config& src_config) noexcept -> void;
+			auto addSource(Source::ID id, std::filesystem::path&& location, MappedFile&& data, const Source::Config& src_config) noexcept -> void;
 
 
 
@@ -96,6 +112,19 @@ namespace panther{
 			// returns number of sources taht failed parsing
 			EVO_NODISCARD auto semanticAnalysis() noexcept -> evo::uint;
 
+			enum class SemanticAnalysisPhase{
+				GlobalIdentsAndImports,
+				GlobalAliases,
+				GlobalTypes,
+				GlobalValues,
+				Runtime, // function bodies
+			};
+
+			// runs a single phase of semantic analysis on every source (semanticAnalysis() runs all of them)
+			// 	phases must be run in order, and not after a phase failed
+			// returns number of sources that failed the phase
+			EVO_NODISCARD auto semanticAnalysis(SemanticAnalysisPhase phase) noexcept -> evo::uint;
+
 
 
 
@@ -137,6 +166,8 @@ namespace panther{
 				return this->types[id.id];
 			};
 
+			EVO_NODISCARD inline auto numTypes() const noexcept -> size_t { return this->types.size(); };
+
 			// TODO: better way of doing this?
 			EVO_NODISCARD static inline auto getTypeImport() noexcept -> PIR::Type::ID { return PIR::Type::ID(0); };
 			EVO_NODISCARD static inline auto getTypeInt() noexcept -> PIR::Type::ID { return PIR::Type::ID(1); };
@@ -168,14 +199,35 @@ namespace panther{
 				return PIR::Intrinsic::ID(static_cast<uint32_t>(kind));
 			};
 
+		private:
+			// runs `phase` on every source (in parallel if configured to)
+			// returns number of sources where `phase` failed
+			EVO_NODISCARD auto run_on_sources(bool(Source::*phase)()) noexcept -> evo::uint;
+
+			EVO_NODISCARD auto get_num_threads() const noexcept -> evo::uint;
+
 		private:
 			Config config;
 
 			std::vector<Source> sources{};
 			bool is_locked = false;
 
-			std::vector<PIR::BaseType> base_types{};
-			std::vector<PIR::Type> types{};
+			// sources added before locking (indexed by ID), moved into `sources` when locked
+			std::vector<std::optional<Source>> pending_sources{};
+			std::mutex pending_sources_mutex{};
+
+			// types can be created from multiple threads during semantic analysis
+			// 	creating / searching requires `types_mutex`, getting by ID does not
+			SegmentedVector<PIR::BaseType> base_types{};
+			SegmentedVector<PIR::Type> types{};
+			mutable std::mutex types_mutex{};
+
+			// hash -> ID (collisions are resolved by comparing with operator==)
+			std::unordered_multimap<size_t, PIR::BaseType::ID> base_type_lookup{};
+			std::unordered_multimap<size_t, PIR::Type::ID> type_lookup{};
+
+			// indexed by (tok_kind - Token::TypeVoid), set in initBuiltinTypes() and never changed afterwards
+			std::array<std::optional<PIR::BaseType::ID>, size_t(Token::TypeUSize) - size_t(Token::TypeVoid) + 1> builtin_base_types{};
 
 			std::optional<Entry> entry{};
 
@@ -186,6 +238,11 @@ namespace panther{
 
 			MessageCallback message_callback;
 
+			// While sources are being worked on in parallel, messages are buffered per source and flushed in
+			// 	source order afterwards so that the output doesn't depend on thread scheduling
+			mutable std::vector<std::vector<Message>> message_buffers{};
+			bool is_buffering_messages = false;
+
 	};
 
 
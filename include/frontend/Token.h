@@ -19,7 +19,7 @@ namespace panther{
 		///////////////////////////////////
 		// kind 
 
-		enum class Kind{
+		enum class Kind : uint8_t {
 			None, // for use as an optional
 
 			Ident,
@@ -137,9 +137,12 @@ namespace panther{
 
 		Kind kind;
 
-		Location location;
+		// position in the source data
+		// 	line / collumn are only computed when needed (Source::getTokenLocation())
+		uint32_t offset;
+		uint32_t length;
 
-		union {
+		union Value {
 			evo::byte none = 0;
 
 			bool boolean;
@@ -149,35 +152,35 @@ namespace panther{
 		} value;
 
 
-		Token(Kind _kind, Location _location) noexcept
-			: kind(_kind), location(_location) {};
+		Token(Kind _kind, uint32_t _offset, uint32_t _length) noexcept
+			: kind(_kind), offset(_offset), length(_length) {};
 
-		Token(Kind _kind, Location _location, std::string_view value) noexcept
-			: kind(_kind), location(_location) {
+		Token(Kind _kind, uint32_t _offset, uint32_t _length, std::string_view value) noexcept
+			: kind(_kind), offset(_offset), length(_length) {
 			this->value.string = value;
 		};
 
 
-		Token(Kind _kind, Location _location, bool value) noexcept
-			: kind(_kind), location(_location) {
+		Token(Kind _kind, uint32_t _offset, uint32_t _length, bool value) noexcept
+			: kind(_kind), offset(_offset), length(_length) {
 			this->value.boolean = value;
 		};
 
 
-		Token(Kind _kind, Location _location, uint64_t value) noexcept
-			: kind(_kind), location(_location) {
+		Token(Kind _kind, uint32_t _offset, uint32_t _length, uint64_t value) noexcept
+			: kind(_kind), offset(_offset), length(_length) {
 			this->value.integer = value;
 		};
 
 
-		Token(Kind _kind, Location _location, float64_t value) noexcept
-			: kind(_kind), location(_location) {
+		Token(Kind _kind, uint32_t _offset, uint32_t _length, float64_t value) noexcept
+			: kind(_kind), offset(_offset), length(_length) {
 			this->value.floatingPoint = value;
 		};
 
 
 		Token(Kind _kind, std::string_view value) noexcept
-			: kind(_kind), location(0, 0, 0, 0) {
+			: kind(_kind), offset(0), length(0) {
 			evo::debugAssert(kind == Kind::Intrinsic, "This constructor should only be used for intrinsics (builtin-initialization)");
 
 			this->value.string = value;
@@ -201,6 +204,45 @@ namespace panther{
 
 
 
+		//////////////////////////////////////////////////////////////////////
+		// storage
+
+		// Compact form of a token (8 bytes) that is what is stored in Source::tokens
+		// 	Source::getToken() turns it back into a full token
+		class Packed{
+			public:
+				static constexpr uint32_t MAX_EXTRA = (uint32_t(1) << 24) - 1;
+
+			public:
+				Packed(Kind kind, uint32_t _offset, uint32_t extra) noexcept
+					: offset(_offset), kind_and_extra(uint32_t(kind) | (extra << 8)) {
+					evo::debugAssert(extra <= MAX_EXTRA, "Token extra data does not fit into 24 bits");
+				};
+
+				EVO_NODISCARD inline auto getKind() const noexcept -> Kind { return static_cast<Kind>(this->kind_and_extra & 0xFF); };
+
+				// For literal ints, floats, chars, and strings: the index of the Payload
+				// For literal bools: the value
+				// Otherwise: the length of the token
+				EVO_NODISCARD inline auto getExtra() const noexcept -> uint32_t { return this->kind_and_extra >> 8; };
+
+			public:
+				uint32_t offset;
+
+			private:
+				uint32_t kind_and_extra;
+		};
+		static_assert(sizeof(Packed) == 8, "Token::Packed is not the expected size");
+
+
+		// value and length of literal tokens that don't fit into Packed (stored in Source::token_payloads)
+		struct Payload{
+			Value value;
+			uint32_t length;
+		};
+
+
+
 		//////////////////////////////////////////////////////////////////////
 		// helper functions
 
@@ -7,19 +7,26 @@
     #pragma warning(disable : 4996)
     #define _SILENCE_CXX20_CISO646_REMOVED_WARNING
 
-        #include <llvm/ExecutionEngine/ExecutionEngine.h>
-        #include <llvm/ExecutionEngine/GenericValue.h>
+        #include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+        #include <llvm/ExecutionEngine/Orc/LLJIT.h>
 
         #include <llvm/IR/IRBuilder.h>
         #include <llvm/IR/NoFolder.h>
 
-        #include <llvm/Transforms/Utils/Cloning.h>
-
         #include <llvm/Support/TargetSelect.h>
 
+        #include <llvm/Bitcode/BitcodeWriter.h>
+        #include <llvm/Config/llvm-config.h>
+        #include <llvm/Support/SHA256.h>
+        #include <llvm/Transforms/Utils/Cloning.h>
+
 
+        #include <llvm/CodeGen/ParallelCG.h>
         #include <llvm/IR/LegacyPassManager.h>
+        #include <llvm/Passes/PassBuilder.h>
+        #include <llvm/IR/Verifier.h>
 
+        #include <llvm/MC/MCSubtargetInfo.h>
         #include <llvm/MC/TargetRegistry.h>
         #include <llvm/Support/FileSystem.h>
         // #include <llvm/Support/TargetSelect.h>
@@ -27,6 +34,7 @@
         // #include <llvm/Target/TargetMachine.h>
         // #include <llvm/Target/TargetOptions.h>
         #include <llvm/TargetParser/Host.h>
+        #include <llvm/TargetParser/Triple.h>
 
 
 
@@ -219,6 +219,7 @@ include "./src/frontend/premake5_Panther_frontend.lua"
 include "./src/LLVM_interface/premake5_LLVM_interface.lua"
 include "./src/LLD_interface/premake5_LLD_interface.lua"
 include "./pthr/premake5_pthr.lua"
+include "./benchmarks/premake5_benchmarks.lua"
 
 
 ------------------------------------------------------------------------------
@@ -232,5 +233,6 @@ project("LLVM_interface").group = "Interfaces"
 project("Panther_frontend").group = "Panther Lib"
 
 project("pthr").group = "Executables"
+project("benchmarks").group = "Executables"
 
 
@@ -0,0 +1,135 @@
+#include "./ObjectCache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <unordered_set>
+
+
+namespace panther{
+	namespace cli{
+
+
+		auto ObjectCache::load(std::string_view key) const noexcept -> std::optional<std::vector<evo::byte>> {
+			const std::filesystem::path path = this->get_path(key);
+
+			std::error_code ec;
+			if(std::filesystem::exists(path, ec) == false){ return std::nullopt; }
+
+			auto file = evo::fs::BinaryFile();
+			if(file.open(path.string(), evo::fs::FileMode::Read) == false){ return std::nullopt; }
+
+			std::optional<std::vector<evo::byte>> object_file = file.read();
+			file.close();
+
+			if(object_file.has_value()){
+				std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+			}
+
+			return object_file;
+		};
+
+
+
+		auto ObjectCache::store(std::string_view key, const std::vector<evo::byte>& object_file) const noexcept -> bool {
+			std::error_code ec;
+			std::filesystem::create_directories(this->directory, ec);
+			if(ec){ return false; }
+
+			// unique to this thread so that builds storing the same key at the same time don't write to the same file
+			const std::filesystem::path temp_path = this->directory / std::format(
+				"{}.{}.{}.tmp",
+				key,
+				std::hash<std::thread::id>{}(std::this_thread::get_id()),
+				std::chrono::steady_clock::now().time_since_epoch().count()
+			);
+
+			auto file = evo::fs::BinaryFile();
+			if(file.open(temp_path.string(), evo::fs::FileMode::Write) == false){ return false; }
+
+			const bool write_succeeded = file.write(object_file);
+			file.close();
+
+			if(write_succeeded){
+				std::filesystem::rename(temp_path, this->get_path(key), ec);
+				if(ec.value() == 0){ return true; }
+			}
+
+			std::filesystem::remove(temp_path, ec);
+			return false;
+		};
+
+
+
+		auto ObjectCache::evict(uint64_t max_size, std::span<const std::string> keys_in_use) const noexcept -> size_t {
+			// a temporary file this old can't still be being written
+			static constexpr auto TEMP_FILE_MAX_AGE = std::chrono::hours(1);
+
+			struct CachedFile{
+				std::filesystem::path path;
+				std::filesystem::file_time_type last_write_time;
+				uint64_t size;
+			};
+
+			auto paths_in_use = std::unordered_set<std::string>();
+			for(const std::string& key : keys_in_use){
+				paths_in_use.emplace(this->get_path(key).string());
+			}
+
+			const std::filesystem::file_time_type now = std::filesystem::file_time_type::clock::now();
+
+			auto evictable_files = std::vector<CachedFile>();
+			uint64_t total_size = 0;
+
+			std::error_code ec;
+			for(const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(this->directory, ec)){
+				if(entry.is_regular_file(ec) == false){ continue; }
+
+				const std::filesystem::file_time_type last_write_time = entry.last_write_time(ec);
+				if(ec){ continue; }
+
+				if(entry.path().extension() == ".tmp"){
+					if(now - last_write_time > TEMP_FILE_MAX_AGE){
+						std::filesystem::remove(entry.path(), ec);
+					}
+					continue;
+				}
+
+				if(entry.path().extension() != ".o"){ continue; }
+
+				const uint64_t size = entry.file_size(ec);
+				if(ec){ continue; }
+
+				total_size += size;
+
+				if(paths_in_use.contains(entry.path().string()) == false){
+					evictable_files.emplace_back(entry.path(), last_write_time, size);
+				}
+			}
+
+			std::ranges::sort(evictable_files, [](const CachedFile& lhs, const CachedFile& rhs) noexcept -> bool {
+				return lhs.last_write_time < rhs.last_write_time;
+			});
+
+			size_t num_removed = 0;
+			for(const CachedFile& cached_file : evictable_files){
+				if(total_size <= max_size){ break; }
+
+				if(std::filesystem::remove(cached_file.path, ec)){
+					total_size -= cached_file.size;
+					num_removed += 1;
+				}
+			}
+
+			return num_removed;
+		};
+
+
+
+		auto ObjectCache::get_path(std::string_view key) const noexcept -> std::filesystem::path {
+			return this->directory / std::format("{}.o", key);
+		};
+
+
+	};
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+
+#include <Evo.h>
+
+#include <filesystem>
+#include <span>
+
+namespace panther{
+	namespace cli{
+
+
+		// Stores generated object files in a directory so that they don't have to be generated again
+		// 	files are named by their key, so changed input gets a new file instead of replacing an old one
+		class ObjectCache{
+			public:
+				ObjectCache(const std::filesystem::path& _directory) noexcept : directory(_directory) {};
+				~ObjectCache() = default;
+
+
+				// returns nullopt if `key` isn't in the cache
+				// 	the modification time of the file is set to now so that `evict()` removes the least recently used files first
+				EVO_NODISCARD auto load(std::string_view key) const noexcept -> std::optional<std::vector<evo::byte>>;
+
+				// the directory is created if it doesn't exist
+				// 	the file is written to a temporary path and then renamed, so other builds using the same cache
+				// 	(or a build that got stopped) never see a partially written file
+				// returns false if failed
+				EVO_NODISCARD auto store(std::string_view key, const std::vector<evo::byte>& object_file) const noexcept -> bool;
+
+				// removes the least recently used object files until the total size of the rest is at most `max_size` bytes
+				// 	the files of `keys_in_use` are never removed (even if they alone are larger than `max_size`)
+				// 	temporary files left by builds that got stopped while storing are removed as well
+				// returns the number of object files removed
+				auto evict(uint64_t max_size, std::span<const std::string> keys_in_use) const noexcept -> size_t;
+
+
+			private:
+				EVO_NODISCARD auto get_path(std::string_view key) const noexcept -> std::filesystem::path;
+
+			private:
+				std::filesystem::path directory;
+		};
+
+
+	};
+};
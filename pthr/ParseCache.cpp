@@ -0,0 +1,39 @@
+#include "./ParseCache.h"
+
+
+namespace panther{
+	namespace cli{
+
+
+		auto ParseCache::reuse(SourceManager& source_manager) noexcept -> size_t {
+			evo::debugAssert(source_manager.isLocked(), "Source manager must be locked");
+
+			size_t num_reused = 0;
+
+			for(Source& source : source_manager.getSources()){
+				const auto find = this->sources.find(source.getData());
+				if(find == this->sources.end()){ continue; }
+
+				// a source with the same data twice in the same compile is only reused once
+				source.setTokensAndAST(std::move(find->second));
+				this->sources.erase(find);
+
+				num_reused += 1;
+			}
+
+			return num_reused;
+		};
+
+
+		auto ParseCache::store(SourceManager& source_manager) noexcept -> void {
+			// sources that are not in this compile anymore are dropped
+			this->sources.clear();
+
+			for(Source& source : source_manager.getSources()){
+				this->sources.try_emplace(std::string(source.getData()), source.extractTokensAndAST());
+			}
+		};
+
+
+	};
+};
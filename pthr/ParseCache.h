@@ -0,0 +1,54 @@
+#pragma once
+
+
+#include <Evo.h>
+
+#include "frontend/SourceManager.h"
+
+#include <unordered_map>
+
+namespace panther{
+	namespace cli{
+
+
+		// Keeps the tokens and AST of each source of the last compile so that sources that didn't change
+		// 	don't have to be tokenized and parsed again (used by the server between requests)
+		// 	sources are looked up by their data, so a source that moved or got renamed is still found
+		class ParseCache{
+			public:
+				ParseCache() noexcept = default;
+				~ParseCache() = default;
+
+				ParseCache(const ParseCache&) = delete;
+				auto operator=(const ParseCache&) = delete;
+
+
+				// moves the tokens and AST of every source with the same data as a source of the last compile into it
+				// 	the source manager must be locked and not tokenized yet
+				// returns the number of sources that don't need to be tokenized and parsed
+				auto reuse(SourceManager& source_manager) noexcept -> size_t;
+
+				// replaces the cache with the tokens and AST of every source
+				// 	every source must have been tokenized and parsed successfully, and must not be used after
+				auto store(SourceManager& source_manager) noexcept -> void;
+
+				EVO_NODISCARD inline auto numSources() const noexcept -> size_t { return this->sources.size(); };
+
+
+			private:
+				// so that sources can be looked up with their data without copying it
+				struct SourceDataHash{
+					using is_transparent = void;
+
+					EVO_NODISCARD auto operator()(std::string_view data) const noexcept -> size_t {
+						return std::hash<std::string_view>{}(data);
+					};
+				};
+
+			private:
+				std::unordered_map<std::string, Source::TokensAndAST, SourceDataHash, std::equal_to<>> sources{};
+		};
+
+
+	};
+};
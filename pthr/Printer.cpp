@@ -12,55 +12,64 @@ namespace panther{
 
 		auto Printer::fatal(std::string_view msg) const noexcept -> void {
 			if(this->use_colors){ evo::styleConsole::fatal(); };
-			evo::print(msg);
+			this->write(msg);
 			if(this->use_colors){ evo::styleConsole::reset(); };
 		};
 
 
 		auto Printer::error(std::string_view msg) const noexcept -> void {
 			if(this->use_colors){ evo::styleConsole::error(); };
-			evo::print(msg);
+			this->write(msg);
 			if(this->use_colors){ evo::styleConsole::reset(); };
 		};
 
 
 		auto Printer::warning(std::string_view msg) const noexcept -> void {
 			if(this->use_colors){ evo::styleConsole::warning(); };
-			evo::print(msg);
+			this->write(msg);
 			if(this->use_colors){ evo::styleConsole::reset(); };
 		};
 
 
 		auto Printer::success(std::string_view msg) const noexcept -> void {
 			if(this->use_colors){ evo::styleConsole::success(); };
-			evo::print(msg);
+			this->write(msg);
 			if(this->use_colors){ evo::styleConsole::reset(); };
 		};
 
 
 		auto Printer::info(std::string_view msg) const noexcept -> void {
 			if(this->use_colors){ evo::styleConsole::info(); };
-			evo::print(msg);
+			this->write(msg);
 			if(this->use_colors){ evo::styleConsole::reset(); };
 		};
 
 
 		auto Printer::debug(std::string_view msg) const noexcept -> void {
 			if(this->use_colors){ evo::styleConsole::debug(); };
-			evo::print(msg);
+			this->write(msg);
 			if(this->use_colors){ evo::styleConsole::reset(); };
 		};
 
 
 		auto Printer::trace(std::string_view msg) const noexcept -> void {
 			if(this->use_colors){ evo::styleConsole::trace(); };
-			evo::print(msg);
+			this->write(msg);
 			if(this->use_colors){ evo::styleConsole::reset(); };
 		};
 
 
 		auto Printer::print(std::string_view msg) const noexcept -> void {
-			evo::print(msg);
+			this->write(msg);
+		};
+
+
+		auto Printer::write(std::string_view msg) const noexcept -> void {
+			if(this->output != nullptr){
+				*this->output += msg;
+			}else{
+				evo::print(msg);
+			}
 		};
 
 
@@ -115,8 +124,9 @@ namespace panther{
 
 			auto location_strings = std::vector<std::string>();
 
-			for(const Token& token : source.tokens){
-				location_strings.push_back( std::format("<{}:{}>", token.location.line_start, token.location.collumn_start) );
+			for(uint32_t i = 0; i < source.tokens.size(); i+=1){
+				const Location location = source.getTokenLocation(Token::ID(i));
+				location_strings.push_back( std::format("<{}:{}>", location.line_start, location.collumn_start) );
 			};
 
 			const size_t longest_location_string_length = std::ranges::max_element(
@@ -138,7 +148,7 @@ namespace panther{
 			for(size_t i = 0; i < source.tokens.size(); i+=1){
 				this->trace(location_strings[i]);
 
-				const Token& token = source.tokens[i];
+				const Token token = source.getToken(Token::ID(uint32_t(i)));
 				this->info( std::format("[{}]", Token::printKind(token.kind)) );
 
 
@@ -168,24 +178,7 @@ namespace panther{
 		auto Printer::print_location(const Source& source, Location location, Message::Type type) const noexcept -> void {
 
 			// find line in the source code
-			size_t cursor = 0;
-			size_t current_line = 1;
-			while(current_line < location.line_start){
-				evo::debugAssert(cursor < source.getData().size(), "out of bounds looking for line in source code for error");
-
-				if(source.getData()[cursor] == '\n'){
-					current_line += 1;
-
-				}else if(source.getData()[cursor] == '\r'){
-					current_line += 1;
-
-					if(source.getData()[cursor + 1] == '\n'){
-						cursor += 1;
-					}
-				}
-
-				cursor += 1;
-			};
+			size_t cursor = source.getLineOffset(location.line_start);
 
 			// get actual line and remove leading whitespace
 
@@ -193,7 +186,7 @@ namespace panther{
 			size_t point_collumn = location.collumn_start;
 			bool remove_whitespace = true;
 
-			while(source.getData()[cursor] != '\n' && source.getData()[cursor] != '\r' && cursor < source.getData().size()){
+			while(cursor < source.getData().size() && source.getData()[cursor] != '\n' && source.getData()[cursor] != '\r'){
 				if(remove_whitespace && (source.getData()[cursor] == '\t' || source.getData()[cursor] == ' ')){
 					// remove leading whitespace
 					point_collumn -= 1;
@@ -525,7 +518,7 @@ namespace panther{
 			this->indenter_pop();
 		};
 
-		auto Printer::print_template_args(const std::vector<AST::Node::ID>& template_args) noexcept -> void {
+		auto Printer::print_template_args(std::span<const AST::Node::ID> template_args) noexcept -> void {
 			this->indenter_print();
 
 
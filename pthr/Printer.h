@@ -16,6 +16,9 @@ namespace panther{
 		class Printer{
 			public:
 				Printer(bool should_use_colors) : use_colors(should_use_colors) {};
+
+				// everything is appended to `output_buffer` instead of being printed (without colors)
+				Printer(std::string& output_buffer) : use_colors(false), output(&output_buffer) {};
 				~Printer() = default;
 
 				auto fatal(std::string_view msg) const noexcept -> void;
@@ -40,6 +43,8 @@ namespace panther{
 
 
 			private:
+				auto write(std::string_view msg) const noexcept -> void;
+
 				auto print_location(const Source& source, Location location, Message::Type type) const noexcept -> void;
 
 
@@ -51,7 +56,7 @@ namespace panther{
 				auto print_func(const AST::Node& node) noexcept -> void;
 				auto print_struct(const AST::Node& node) noexcept -> void;
 				auto print_template_pack(const std::optional<AST::Node::ID>& opt_node_id) noexcept -> void;
-				auto print_template_args(const std::vector<AST::Node::ID>& template_args) noexcept -> void;
+				auto print_template_args(std::span<const AST::Node::ID> template_args) noexcept -> void;
 				auto print_func_params(const AST::Node& node) noexcept -> void;
 				auto print_conditional(const AST::Node& node) noexcept -> void;
 				auto print_return(const AST::Node& node) noexcept -> void;
@@ -91,6 +96,7 @@ namespace panther{
 
 			private:
 				bool use_colors;
+				std::string* output = nullptr;
 				const Source* ast_source = nullptr;
 		};
 		
@@ -0,0 +1,246 @@
+#include "./Server.h"
+
+
+#if defined(EVO_PLATFORM_WINDOWS)
+	#if !defined(WIN32_LEAN_AND_MEAN)
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#if !defined(NOCOMM)
+		#define NOCOMM
+	#endif
+
+	#if !defined(NOMINMAX)
+		#define NOMINMAX
+	#endif
+
+	#include <winsock2.h>
+	#include <afunix.h>
+
+#else
+	#include <sys/socket.h>
+	#include <sys/time.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+#include <cstring>
+
+
+namespace panther{
+	namespace cli{
+
+		#if defined(EVO_PLATFORM_WINDOWS)
+			using SocketHandle = SOCKET;
+			static constexpr SocketHandle invalid_socket_handle = INVALID_SOCKET;
+
+			static auto close_socket(SocketHandle socket_handle) noexcept -> void { ::closesocket(socket_handle); };
+
+			// sending to a client that closed the connection already only fails the send
+			static constexpr int send_flags = 0;
+
+		#else
+			using SocketHandle = int;
+			static constexpr SocketHandle invalid_socket_handle = -1;
+
+			static auto close_socket(SocketHandle socket_handle) noexcept -> void { ::close(socket_handle); };
+
+			// so that a client that closed the connection already doesn't stop the server with SIGPIPE
+			#if defined(MSG_NOSIGNAL)
+				static constexpr int send_flags = MSG_NOSIGNAL;
+			#else
+				static constexpr int send_flags = 0;
+			#endif
+		#endif
+
+
+		// requests are a single short line, so anything longer isn't a valid request
+		static constexpr size_t MAX_REQUEST_SIZE = 4096;
+
+		// so that a client that connects but never sends its request doesn't stop the server from handling other requests
+		static constexpr uint32_t RECEIVE_TIMEOUT_MS = 5000;
+
+
+
+		// if another server is listening on the socket at `address`
+		static auto is_socket_in_use(const sockaddr_un& address) noexcept -> bool {
+			const SocketHandle socket_handle = ::socket(AF_UNIX, SOCK_STREAM, 0);
+			if(socket_handle == invalid_socket_handle){ return true; }
+
+			const bool connected = ::connect(socket_handle, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+			close_socket(socket_handle);
+
+			return connected;
+		};
+
+
+
+		auto Server::open(const std::filesystem::path& socket_path) noexcept -> bool {
+			evo::debugAssert(this->isOpen() == false, "Server is already open");
+
+			auto address = sockaddr_un();
+			address.sun_family = AF_UNIX;
+
+			const std::string path_str = socket_path.string();
+			if(path_str.size() >= sizeof(address.sun_path)){ return false; }
+			std::memcpy(address.sun_path, path_str.c_str(), path_str.size() + 1);
+
+
+			#if defined(EVO_PLATFORM_WINDOWS)
+				auto wsa_data = WSADATA();
+				if(::WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0){ return false; }
+			#endif
+
+			const auto fail = [&]() noexcept -> bool {
+				#if defined(EVO_PLATFORM_WINDOWS)
+					::WSACleanup();
+				#endif
+				return false;
+			};
+
+
+			const SocketHandle listen_socket_handle = ::socket(AF_UNIX, SOCK_STREAM, 0);
+			if(listen_socket_handle == invalid_socket_handle){ return fail(); }
+
+			// only a socket that no server is listening on (like from a server that got stopped) is replaced
+			std::error_code ec;
+			if(std::filesystem::exists(socket_path, ec)){
+				if(std::filesystem::is_socket(socket_path, ec) == false || is_socket_in_use(address)){
+					close_socket(listen_socket_handle);
+					return fail();
+				}
+
+				std::filesystem::remove(socket_path, ec);
+			}
+
+			if(
+				::bind(listen_socket_handle, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0
+				|| ::listen(listen_socket_handle, SOMAXCONN) != 0
+			){
+				close_socket(listen_socket_handle);
+				return fail();
+			}
+
+			this->listen_socket = uintptr_t(listen_socket_handle);
+			this->path = socket_path;
+			this->is_open = true;
+			return true;
+		};
+
+
+		auto Server::close() noexcept -> void {
+			if(this->isOpen() == false){ return; }
+
+			this->close_connection();
+
+			close_socket(SocketHandle(this->listen_socket));
+			this->listen_socket = 0;
+
+			std::error_code ec;
+			std::filesystem::remove(this->path, ec);
+			this->path.clear();
+
+			#if defined(EVO_PLATFORM_WINDOWS)
+				::WSACleanup();
+			#endif
+
+			this->is_open = false;
+		};
+
+
+
+		auto Server::waitForRequest() noexcept -> evo::Expected<std::string, RequestError> {
+			evo::debugAssert(this->isOpen(), "Server is not open");
+			evo::debugAssert(this->has_connection == false, "Did not respond to the last request");
+
+			const SocketHandle connection_handle = ::accept(SocketHandle(this->listen_socket), nullptr, nullptr);
+			if(connection_handle == invalid_socket_handle){ return evo::Unexpected(RequestError::AcceptFailed); }
+
+			this->connection = uintptr_t(connection_handle);
+			this->has_connection = true;
+
+			#if defined(EVO_PLATFORM_WINDOWS)
+				const auto receive_timeout = DWORD(RECEIVE_TIMEOUT_MS);
+			#else
+				const auto receive_timeout = timeval{
+					.tv_sec  = time_t(RECEIVE_TIMEOUT_MS / 1000),
+					.tv_usec = suseconds_t((RECEIVE_TIMEOUT_MS % 1000) * 1000),
+				};
+			#endif
+
+			if(
+				::setsockopt(
+					connection_handle, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&receive_timeout), sizeof(receive_timeout)
+				) != 0
+			){
+				this->close_connection();
+				return evo::Unexpected(RequestError::ReceiveFailed);
+			}
+
+
+			auto request = std::string();
+
+			while(request.size() < MAX_REQUEST_SIZE){
+				char buffer[256];
+				const int num_received = int(::recv(connection_handle, buffer, int(sizeof(buffer)), 0));
+
+				// also if the client took longer than RECEIVE_TIMEOUT_MS
+				if(num_received < 0){
+					this->close_connection();
+					return evo::Unexpected(RequestError::ReceiveFailed);
+				}
+
+				// client closed its writing end
+				if(num_received == 0){ break; }
+
+				request.append(buffer, size_t(num_received));
+
+				const size_t line_end = request.find('\n');
+				if(line_end != std::string::npos){
+					request.resize(line_end);
+					break;
+				}
+			}
+
+			if(request.size() >= MAX_REQUEST_SIZE){
+				this->close_connection();
+				return evo::Unexpected(RequestError::ReceiveFailed);
+			}
+
+			if(request.empty() == false && request.back() == '\r'){
+				request.pop_back();
+			}
+
+			return request;
+		};
+
+
+		auto Server::respond(std::string_view response) noexcept -> void {
+			evo::debugAssert(this->has_connection, "No request to respond to");
+
+			const SocketHandle connection_handle = SocketHandle(this->connection);
+
+			size_t num_sent = 0;
+			while(num_sent < response.size()){
+				const int result = int(::send(connection_handle, response.data() + num_sent, int(response.size() - num_sent), send_flags));
+				if(result <= 0){ break; }
+
+				num_sent += size_t(result);
+			}
+
+			this->close_connection();
+		};
+
+
+
+		auto Server::close_connection() noexcept -> void {
+			if(this->has_connection == false){ return; }
+
+			close_socket(SocketHandle(this->connection));
+			this->connection = 0;
+			this->has_connection = false;
+		};
+
+
+	};
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+
+#include <Evo.h>
+
+#include <filesystem>
+
+namespace panther{
+	namespace cli{
+
+
+		// Receives compile requests over a local (Unix domain) socket so that the compiler doesn't have to be started for each one
+		// 	(also supported on Windows 10 and later)
+		// 	requests are handled one at a time
+		// 	protocol:
+		// 		- the client connects and sends a single line (the request) and then either closes its writing end or waits
+		// 		- the server sends the response and then closes the connection
+		class Server{
+			public:
+				Server() noexcept = default;
+				~Server() noexcept { this->close(); };
+
+				Server(const Server&) = delete;
+				auto operator=(const Server&) = delete;
+
+
+				// if a socket that no server is listening on already exists at `socket_path` (like from a server that got stopped),
+				// 	it's replaced
+				// returns false if failed (including if another server is listening on `socket_path` or it's not a socket)
+				EVO_NODISCARD auto open(const std::filesystem::path& socket_path) noexcept -> bool;
+				auto close() noexcept -> void;
+
+				EVO_NODISCARD inline auto isOpen() const noexcept -> bool { return this->is_open; };
+
+
+				enum class RequestError{
+					AcceptFailed, // no client could be accepted (like if the process is out of file descriptors)
+					ReceiveFailed, // the client disconnected, sent an invalid request, or didn't send it in time
+				};
+
+				// waits until a client connects and returns the request (without the line ending)
+				// 	respond() must be called before waiting for the next request
+				// 	the server is still open after an error
+				EVO_NODISCARD auto waitForRequest() noexcept -> evo::Expected<std::string, RequestError>;
+
+				// sends the response to the client of the last request and closes the connection to it
+				// 	a client that disconnected already isn't an error
+				auto respond(std::string_view response) noexcept -> void;
+
+
+			private:
+				auto close_connection() noexcept -> void;
+
+			private:
+				// the socket handles are stored as integers so that the platform headers aren't needed here
+				// 	(SOCKET on Windows, file descriptor everywhere else)
+				uintptr_t listen_socket = 0;
+				uintptr_t connection = 0;
+				bool has_connection = false;
+				bool is_open = false;
+
+				std::filesystem::path path{};
+		};
+
+
+	};
+};
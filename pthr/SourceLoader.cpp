@@ -0,0 +1,210 @@
+#include "./SourceLoader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+
+namespace panther{
+	namespace cli{
+
+
+		auto SourceLoader::discoverFiles(const std::filesystem::path& directory) const noexcept
+		-> std::optional<std::vector<std::filesystem::path>> {
+			auto found_files = std::vector<std::filesystem::path>();
+			auto pending_directories = std::vector<std::filesystem::path>{directory};
+			size_t num_busy_workers = 0;
+			bool failed = false;
+
+			auto mutex = std::mutex();
+			auto condition = std::condition_variable();
+
+			// each worker reads one directory at a time, and subdirectories are added back to the queue
+			// 	so that other workers can pick them up
+			const auto worker = [&]() noexcept -> void {
+				while(true){
+					auto current_directory = std::filesystem::path();
+
+					{
+						auto lock = std::unique_lock(mutex);
+						condition.wait(lock, [&]() noexcept -> bool {
+							return pending_directories.empty() == false || num_busy_workers == 0;
+						});
+
+						// no directories left and no worker that could add any more
+						if(pending_directories.empty()){ return; }
+
+						current_directory = std::move(pending_directories.back());
+						pending_directories.pop_back();
+						num_busy_workers += 1;
+					}
+
+
+					auto subdirectories = std::vector<std::filesystem::path>();
+					auto files = std::vector<std::filesystem::path>();
+
+					std::error_code ec;
+					for(
+						auto iter = std::filesystem::directory_iterator(current_directory, ec);
+						ec.value() == 0 && iter != std::filesystem::directory_iterator();
+						iter.increment(ec)
+					){
+						const std::filesystem::directory_entry& entry = *iter;
+
+						// symlinks to directories are skipped so that cycles can't happen
+						std::error_code entry_ec;
+						if(entry.is_symlink(entry_ec) == false && entry.is_directory(entry_ec)){
+							subdirectories.emplace_back(entry.path());
+
+						}else if(entry.is_regular_file(entry_ec) && entry.path().extension() == ".pthr"){
+							files.emplace_back(entry.path());
+						}
+					}
+
+
+					{
+						const auto lock = std::scoped_lock(mutex);
+
+						if(ec.value() != 0){ failed = true; }
+
+						for(std::filesystem::path& subdirectory : subdirectories){
+							pending_directories.emplace_back(std::move(subdirectory));
+						}
+
+						for(std::filesystem::path& file : files){
+							found_files.emplace_back(std::move(file));
+						}
+
+						num_busy_workers -= 1;
+					}
+
+					condition.notify_all();
+				}
+			};
+
+
+			// the calling thread is one of the workers
+			const evo::uint num_threads = this->get_num_threads(std::numeric_limits<size_t>::max());
+
+			auto workers = std::vector<std::thread>();
+			workers.reserve(num_threads - 1);
+			for(evo::uint i = 0; i < num_threads - 1; i+=1){
+				workers.emplace_back(worker);
+			}
+
+			worker();
+
+			for(std::thread& worker_thread : workers){
+				worker_thread.join();
+			}
+
+
+			if(failed){ return std::nullopt; }
+
+			std::sort(found_files.begin(), found_files.end());
+			return found_files;
+		};
+
+
+
+		auto SourceLoader::loadFiles(
+			std::vector<std::filesystem::path>&& file_paths, SourceManager& source_manager, const Source::Config& src_config
+		) const noexcept -> evo::Expected<std::vector<Source::ID>, std::vector<std::filesystem::path>> {
+			const Source::ID first_id = source_manager.reserveSourceIDs(uint32_t(file_paths.size()));
+
+			// not std::vector<bool> since each element is written from a different thread
+			auto load_failed = std::vector<evo::byte>(file_paths.size(), false);
+			auto next_file_index = std::atomic<size_t>(0);
+
+			const auto worker = [&]() noexcept -> void {
+				auto file = evo::fs::File{};
+
+				while(true){
+					const size_t file_index = next_file_index.fetch_add(1, std::memory_order_relaxed);
+					if(file_index >= file_paths.size()){ return; }
+
+					std::filesystem::path& file_path = file_paths[file_index];
+					const auto src_id = Source::ID(first_id.id + uint32_t(file_index));
+
+					if(this->config.memoryMapFiles){
+						auto mapped_file = MappedFile{};
+						if(mapped_file.open(file_path) == false){
+							load_failed[file_index] = true;
+							continue;
+						}
+
+						source_manager.addSource(src_id, std::move(file_path), std::move(mapped_file), src_config);
+						continue;
+					}
+
+					if(file.open(file_path.string(), evo::fs::FileMode::Read) == false){
+						load_failed[file_index] = true;
+						continue;
+					}
+
+					std::optional<std::string> file_data = file.read();
+					file.close();
+
+					if(file_data.has_value() == false){
+						load_failed[file_index] = true;
+						continue;
+					}
+
+					source_manager.addSource(src_id, std::move(file_path), std::move(*file_data), src_config);
+				}
+			};
+
+
+			// the calling thread is one of the workers
+			const evo::uint num_threads = this->get_num_threads(file_paths.size());
+
+			auto workers = std::vector<std::thread>();
+			workers.reserve(num_threads - 1);
+			for(evo::uint i = 0; i < num_threads - 1; i+=1){
+				workers.emplace_back(worker);
+			}
+
+			worker();
+
+			for(std::thread& worker_thread : workers){
+				worker_thread.join();
+			}
+
+
+			auto failed_paths = std::vector<std::filesystem::path>();
+			for(size_t i = 0; i < file_paths.size(); i+=1){
+				if(load_failed[i]){
+					failed_paths.emplace_back(std::move(file_paths[i]));
+				}
+			}
+
+			if(failed_paths.empty() == false){
+				return evo::Unexpected(std::move(failed_paths));
+			}
+
+
+			auto source_ids = std::vector<Source::ID>();
+			source_ids.reserve(file_paths.size());
+			for(size_t i = 0; i < file_paths.size(); i+=1){
+				source_ids.emplace_back(first_id.id + uint32_t(i));
+			}
+
+			return source_ids;
+		};
+
+
+
+		auto SourceLoader::get_num_threads(size_t num_jobs) const noexcept -> evo::uint {
+			evo::uint num_threads = this->config.numThreads;
+
+			// hardware_concurrency() is allowed to return 0 if it can't be determined
+			if(num_threads == 0){ num_threads = evo::uint(std::thread::hardware_concurrency()); }
+
+			return evo::uint(std::clamp(size_t(num_threads), size_t(1), std::max(num_jobs, size_t(1))));
+		};
+
+
+	};
+};
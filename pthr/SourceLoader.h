@@ -0,0 +1,55 @@
+#pragma once
+
+
+#include <Evo.h>
+
+
+#include "frontend/SourceManager.h"
+
+#include <filesystem>
+
+namespace panther{
+	namespace cli{
+
+
+		// Finds and loads source files on multiple threads
+		class SourceLoader{
+			public:
+				struct Config{
+					// 0 means use the number of hardware threads
+					evo::uint numThreads = 0;
+
+					// map files into memory instead of reading them into a buffer
+					bool memoryMapFiles = true;
+				};
+
+			public:
+				SourceLoader(const Config& _config) noexcept : config(_config) {};
+				~SourceLoader() = default;
+
+
+				// recursively finds every `.pthr` file in `directory`
+				// 	the paths are sorted so the order doesn't depend on which thread found which file
+				// returns nullopt if any directory couldn't be read
+				EVO_NODISCARD auto discoverFiles(const std::filesystem::path& directory) const noexcept
+					-> std::optional<std::vector<std::filesystem::path>>;
+
+
+				// adds every file in `file_paths` to `source_manager`
+				// 	the source IDs are given in the order of `file_paths` no matter which file finished loading first
+				// returns the IDs if successful, and the paths that failed to load otherwise
+				EVO_NODISCARD auto loadFiles(
+					std::vector<std::filesystem::path>&& file_paths, SourceManager& source_manager, const Source::Config& src_config
+				) const noexcept -> evo::Expected<std::vector<Source::ID>, std::vector<std::filesystem::path>>;
+
+
+			private:
+				EVO_NODISCARD auto get_num_threads(size_t num_jobs) const noexcept -> evo::uint;
+
+			private:
+				Config config;
+		};
+
+
+	};
+};
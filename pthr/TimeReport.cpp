@@ -0,0 +1,210 @@
+#include "./TimeReport.h"
+
+#include "Trace.h"
+
+
+#if defined(EVO_PLATFORM_WINDOWS)
+	#if !defined(WIN32_LEAN_AND_MEAN)
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#if !defined(NOCOMM)
+		#define NOCOMM
+	#endif
+
+	#if !defined(NOMINMAX)
+		#define NOMINMAX
+	#endif
+
+	#include <Windows.h>
+	#include <psapi.h>
+
+#elif defined(EVO_PLATFORM_LINUX)
+	#include <sys/resource.h>
+#endif
+
+
+namespace panther{
+	namespace cli{
+
+
+		auto TimeReport::beginPhase(std::string_view name) noexcept -> void {
+			evo::debugAssert(this->isInPhase() == false, "Previous phase was not ended");
+
+			this->current_phase = CurrentPhase(std::string(name), take_sample());
+		};
+
+
+		auto TimeReport::endPhase(std::vector<Count>&& counts) noexcept -> void {
+			evo::debugAssert(this->isInPhase(), "No phase to end");
+
+			const Sample end = take_sample();
+			const Sample& start = this->current_phase->start;
+
+			Trace::record(std::string(this->current_phase->name), std::string(), start.wallTime, end.wallTime);
+
+			this->phases.emplace_back(
+				std::move(this->current_phase->name),
+				std::chrono::duration<double, std::milli>(end.wallTime - start.wallTime).count(),
+				end.cpuTimeMS - start.cpuTimeMS,
+				end.peakMemory - start.peakMemory,
+				std::move(counts)
+			);
+
+			this->current_phase.reset();
+		};
+
+
+
+		auto TimeReport::printTable() const noexcept -> std::string {
+			auto output = std::string();
+
+			size_t name_width = std::string_view("Total").size();
+			for(const Phase& phase : this->phases){
+				name_width = std::max(name_width, phase.name.size());
+			}
+
+			const auto print_row = [&](
+				std::string_view name, std::string_view wall_time, std::string_view cpu_time, std::string_view memory, std::string_view counts
+			) noexcept -> void {
+				output += std::format("{:<{}}  {:>10}  {:>10}  {:>14}  {}\n", name, name_width, wall_time, cpu_time, memory, counts);
+			};
+
+			print_row("Phase", "Wall (ms)", "CPU (ms)", "Peak RSS (MiB)", "Counts");
+
+			double total_wall_time = 0;
+			double total_cpu_time = 0;
+			uint64_t total_peak_memory_growth = 0;
+
+			for(const Phase& phase : this->phases){
+				auto counts = std::string();
+				for(const Count& count : phase.counts){
+					if(counts.empty() == false){ counts += ", "; }
+					counts += std::format("{}: {}", count.name, count.value);
+				}
+
+				print_row(
+					phase.name,
+					std::format("{:.3f}", phase.wallTimeMS),
+					std::format("{:.3f}", phase.cpuTimeMS),
+					std::format("+{:.2f}", double(phase.peakMemoryGrowth) / (1024.0 * 1024.0)),
+					counts
+				);
+
+				total_wall_time += phase.wallTimeMS;
+				total_cpu_time += phase.cpuTimeMS;
+				total_peak_memory_growth += phase.peakMemoryGrowth;
+			}
+
+			print_row(
+				"Total",
+				std::format("{:.3f}", total_wall_time),
+				std::format("{:.3f}", total_cpu_time),
+				std::format("+{:.2f}", double(total_peak_memory_growth) / (1024.0 * 1024.0)),
+				""
+			);
+
+			return output;
+		};
+
+
+
+		auto TimeReport::printJSON(std::span<const std::pair<std::string_view, std::string>> context) const noexcept
+		-> std::string {
+			const auto escape = [](std::string_view str) noexcept -> std::string {
+				auto escaped = std::string();
+				escaped.reserve(str.size());
+
+				for(char character : str){
+					switch(character){
+						break; case '"':  escaped += "\\\"";
+						break; case '\\': escaped += "\\\\";
+						break; case '\n': escaped += "\\n";
+						break; case '\t': escaped += "\\t";
+						break; default: {
+							if(uint8_t(character) < 0x20){
+								escaped += std::format("\\u{:04x}", uint8_t(character));
+							}else{
+								escaped += character;
+							}
+						}
+					};
+				}
+
+				return escaped;
+			};
+
+
+			auto output = std::string("{\n");
+
+			output += "\t\"context\": {";
+			for(size_t i = 0; i < context.size(); i+=1){
+				output += std::format(
+					"{}\n\t\t\"{}\": \"{}\"", i == 0 ? "" : ",", escape(context[i].first), escape(context[i].second)
+				);
+			}
+			output += context.empty() ? "},\n" : "\n\t},\n";
+
+			output += "\t\"phases\": [";
+			for(size_t i = 0; i < this->phases.size(); i+=1){
+				const Phase& phase = this->phases[i];
+
+				output += std::format(
+					"{}\n\t\t{{\"name\": \"{}\", \"wall_ms\": {:.3f}, \"cpu_ms\": {:.3f}, \"peak_rss_growth_bytes\": {}, \"counts\": {{",
+					i == 0 ? "" : ",", escape(phase.name), phase.wallTimeMS, phase.cpuTimeMS, phase.peakMemoryGrowth
+				);
+
+				for(size_t j = 0; j < phase.counts.size(); j+=1){
+					output += std::format(
+						"{}\"{}\": {}", j == 0 ? "" : ", ", escape(phase.counts[j].name), phase.counts[j].value
+					);
+				}
+
+				output += "}}";
+			}
+			output += this->phases.empty() ? "]\n" : "\n\t]\n";
+
+			output += "}\n";
+
+			return output;
+		};
+
+
+
+		auto TimeReport::take_sample() noexcept -> Sample {
+			auto sample = Sample(std::chrono::steady_clock::now(), 0, 0);
+
+			#if defined(EVO_PLATFORM_WINDOWS)
+				// FILETIME is in 100 nanosecond intervals
+				const auto to_ms = [](const FILETIME& file_time) noexcept -> double {
+					return double((uint64_t(file_time.dwHighDateTime) << 32) | uint64_t(file_time.dwLowDateTime)) / 10'000.0;
+				};
+
+				FILETIME creation_time, exit_time, kernel_time, user_time;
+				if(::GetProcessTimes(::GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time)){
+					sample.cpuTimeMS = to_ms(kernel_time) + to_ms(user_time);
+				}
+
+				auto memory_counters = PROCESS_MEMORY_COUNTERS();
+				if(::GetProcessMemoryInfo(::GetCurrentProcess(), &memory_counters, sizeof(memory_counters))){
+					sample.peakMemory = uint64_t(memory_counters.PeakWorkingSetSize);
+				}
+
+			#elif defined(EVO_PLATFORM_LINUX)
+				auto usage = rusage();
+				if(::getrusage(RUSAGE_SELF, &usage) == 0){
+					const auto to_ms = [](const timeval& time) noexcept -> double {
+						return double(time.tv_sec) * 1000.0 + double(time.tv_usec) / 1000.0;
+					};
+
+					sample.cpuTimeMS = to_ms(usage.ru_utime) + to_ms(usage.ru_stime);
+					sample.peakMemory = uint64_t(usage.ru_maxrss) * 1024; // in kilobytes
+				}
+			#endif
+
+			return sample;
+		};
+
+
+	};
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+
+#include <Evo.h>
+
+#include <chrono>
+
+namespace panther{
+	namespace cli{
+
+
+		// Measures the time and memory used by each phase of compilation
+		// 	phases are also recorded as trace spans if tracing is enabled
+		class TimeReport{
+			public:
+				// number of items (tokens, AST nodes, etc.) a phase produced
+				struct Count{
+					std::string_view name;
+					uint64_t value;
+				};
+
+				struct Phase{
+					std::string name;
+					double wallTimeMS;
+					double cpuTimeMS; // of every thread in the process
+					uint64_t peakMemoryGrowth; // in bytes, how much the peak resident set size grew during the phase
+					std::vector<Count> counts;
+				};
+
+			public:
+				TimeReport() noexcept = default;
+				~TimeReport() = default;
+
+
+				// the previous phase must be ended first
+				auto beginPhase(std::string_view name) noexcept -> void;
+				auto endPhase(std::vector<Count>&& counts = {}) noexcept -> void;
+
+				EVO_NODISCARD inline auto getPhases() const noexcept -> std::span<const Phase> { return this->phases; };
+				EVO_NODISCARD inline auto isInPhase() const noexcept -> bool { return this->current_phase.has_value(); };
+
+
+				EVO_NODISCARD auto printTable() const noexcept -> std::string;
+
+				// `context` is extra information added to the JSON (like the optimization level) so reports can be compared
+				EVO_NODISCARD auto printJSON(std::span<const std::pair<std::string_view, std::string>> context) const noexcept
+					-> std::string;
+
+
+			private:
+				struct Sample{
+					std::chrono::steady_clock::time_point wallTime;
+					double cpuTimeMS;
+					uint64_t peakMemory;
+				};
+
+				EVO_NODISCARD static auto take_sample() noexcept -> Sample;
+
+			private:
+				std::vector<Phase> phases{};
+
+				struct CurrentPhase{
+					std::string name;
+					Sample start;
+				};
+				std::optional<CurrentPhase> current_phase{};
+		};
+
+
+	};
+};
@@ -1,14 +1,21 @@
 
+#include "./ObjectCache.h"
+#include "./ParseCache.h"
 #include "./Printer.h"
+#include "./Server.h"
+#include "./SourceLoader.h"
+#include "./TimeReport.h"
 #include "frontend/SourceManager.h"
 #include "LLVM_interface/Context.h"
 #include "LLD_interface/LLDInterface.h"
 #include "PIRToLLVMIR.h"
+#include "Trace.h"
 
 
 #include <Evo.h>
 #include <iostream>
 #include <filesystem>
+#include <thread>
 
 
 
@@ -34,6 +41,73 @@ struct Config{
 	bool print_colors;
 	bool verbose;
 
+	// 0 means use the number of hardware threads
+	evo::uint num_threads = 0;
+
+	// map files into memory instead of reading them into a buffer (avoids copying the files)
+	bool memory_map_files = true;
+
+	// if set, every ".pthr" file in this directory (and its subdirectories) is compiled
+	// 	relative to `relative_directory`
+	std::filesystem::path source_directory{};
+
+	// number of threads the JIT compiles functions on (only used by the `Run` target)
+	// 	0 means functions are compiled on the thread that calls them
+	evo::uint jit_compile_threads = 0;
+
+	// number of parts the program is split into to generate machine code on multiple threads (only used by the `Executable` target)
+	// 	the executable only depends on this number, so it's not based on the number of hardware threads
+	evo::uint codegen_partitions = 1;
+
+	// if set, the object file of each source is cached in this directory so that only the sources that changed
+	// 	(or that use something that changed) need machine code to be generated again (only used by the `Executable` target)
+	// 	each source is optimized separately, and `codegen_partitions` is not used
+	// 	relative to `relative_directory`
+	std::filesystem::path object_cache_directory{};
+
+	// after each build the least recently used object files are removed from `object_cache_directory`
+	// 	until it is at most this many bytes (the object files of the current build are always kept)
+	// 	0 means no limit
+	uint64_t object_cache_max_size = 1024ull * 1024 * 1024;
+
+	// print how long each phase of compilation took (wall and CPU time), how much it grew the peak memory usage,
+	// 	and how many items it produced (tokens, AST nodes, LLVM instructions, etc.)
+	bool time_report = false;
+
+	// if set, the time report is also written to this file as JSON
+	// 	relative to `relative_directory`
+	std::filesystem::path time_report_json_path{};
+
+	// if set, trace spans of each phase, source, function, and LLVM pass are written to this file
+	// 	in the Chrome trace event format (open with chrome://tracing or https://ui.perfetto.dev)
+	// 	relative to `relative_directory`
+	std::filesystem::path trace_output_path{};
+
+	// if set, the compiler waits for compile requests on this local socket instead of compiling once
+	// 	(so that starting the process and initializing LLVM isn't paid for every compile)
+	// 	a request is a line with the name of the target (empty means `target`), or "shutdown" to stop the server
+	// 	the response is the exit code on the first line, followed by everything that was printed
+	// 	`Run` requests are rejected (the program would run inside of the server)
+	// 	sources that didn't change since the last request are not tokenized and parsed again
+	// 	relative to `relative_directory`
+	std::filesystem::path server_socket_path{};
+
+	// optimization level of the generated code
+	panther::llvmint::OptLevel opt_level = panther::llvmint::OptLevel::O0;
+
+	// empty means the target triple of this machine
+	std::string target_triple{};
+
+	// "native" means the CPU of this machine (and all of its features)
+	// 	only valid if `target_triple` has the architecture of this machine
+	std::string target_cpu = "generic";
+
+	// LLVM feature string (for example: "+avx2,+fma")
+	std::string target_features{};
+
+	panther::llvmint::RelocModel reloc_model = panther::llvmint::RelocModel::PIC;
+	panther::llvmint::CodeModel code_model = panther::llvmint::CodeModel::Default;
+
 	enum class Target{
 		PrintTokens,
 		PrintAST,
@@ -51,28 +125,81 @@ struct Config{
 };
 
 
-auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexcept -> int {
-	auto config = Config{
-		.name		  = "testing",
-		.print_colors = true,
-		.verbose      = true,
-		.target       = Config::Target::Run,
-	};
+// compiles the program as configured by `config`
+// 	if `parse_cache` isn't null, the tokens and AST of the sources are taken from it and stored in it after
+// returns the exit code
+static auto compile(
+	const Config& config, panther::cli::Printer& printer, panther::cli::ParseCache* parse_cache = nullptr
+) noexcept -> int {
+	auto llvm_context = panther::llvmint::Context();
+	auto pir_to_llvmir = panther::PIRToLLVMIR();
 
+	auto source_manager = panther::SourceManager(
+		panther::SourceManager::Config{
+			.basePath   = config.relative_directory.string(),
+			.numThreads = config.num_threads,
+		},
+		[&](const panther::Message& message){
+			printer.print_message(message);
+		}
+	);
 
-	// print UTF-8 characters on windows
-	#if defined(EVO_PLATFORM_WINDOWS)
-		::SetConsoleOutputCP(CP_UTF8);
-	#endif
-	
+	// only sources that were parsed successfully can be stored in the parse cache
+	bool parsed_all_sources = false;
 
-	auto printer = panther::cli::Printer(config.print_colors);
 
-	auto llvm_context = panther::llvmint::Context();
-	auto pir_to_llvmir = panther::PIRToLLVMIR();
+	auto time_report = panther::cli::TimeReport();
 
 
 	auto exit = [&](){
+		// the phase that failed (if any)
+		if(time_report.isInPhase()){ time_report.endPhase(); }
+
+		if(config.time_report){
+			printer.trace("------------------------------\nTime Report:\n");
+			printer.info(time_report.printTable());
+
+			if(config.time_report_json_path.empty() == false){
+				const auto context = std::array<std::pair<std::string_view, std::string>, 5>{
+					std::pair<std::string_view, std::string>("name", config.name),
+					std::pair<std::string_view, std::string>("opt_level", std::format("O{}", evo::uint(config.opt_level))),
+					std::pair<std::string_view, std::string>("target_triple", config.target_triple),
+					std::pair<std::string_view, std::string>("target_cpu", config.target_cpu),
+					std::pair<std::string_view, std::string>("num_threads", std::to_string(config.num_threads)),
+				};
+
+				const std::string path_str = (config.relative_directory / config.time_report_json_path).string();
+
+				auto json_file = evo::fs::File();
+				if(json_file.open(path_str, evo::fs::FileMode::Write)){
+					if(json_file.write(time_report.printJSON(context)) == false){
+						printer.error(std::format("Failed to write to file: \"{}\"\n", path_str));
+					}
+
+					json_file.close();
+
+				}else{
+					printer.error(std::format("Failed to open file: \"{}\"\n", path_str));
+				}
+			}
+		}
+
+		if(config.trace_output_path.empty() == false){
+			const std::string path_str = (config.relative_directory / config.trace_output_path).string();
+
+			auto trace_file = evo::fs::File();
+			if(trace_file.open(path_str, evo::fs::FileMode::Write)){
+				if(trace_file.write(panther::Trace::printJSON()) == false){
+					printer.error(std::format("Failed to write to file: \"{}\"\n", path_str));
+				}
+
+				trace_file.close();
+
+			}else{
+				printer.error(std::format("Failed to open file: \"{}\"\n", path_str));
+			}
+		}
+
 		if(pir_to_llvmir.isInitialized()){
 			pir_to_llvmir.shutdown();
 		}
@@ -81,29 +208,17 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 			llvm_context.shutdown();
 		}
 
-		#if !defined(PANTHER_BUILD_DIST) && defined(EVO_COMPILER_MSVC)
-			printer.trace("Press Enter to close...\n");
-			std::cin.get();
-		#endif
-	};
-
-
-	if(config.relative_directory_set == false){
-		std::error_code ec;
-		config.relative_directory = std::filesystem::current_path(ec);
-		if(ec){
-			printer.error("Failed to get relative directory\n");
-			printer.error(std::format("\tcode: \"{}\"\n", ec.value()));
-			printer.error(std::format("\tmessage: \"{}\"\n", ec.message()));
-
-			exit();
-			return 1;
+		// last since the tokens and AST are moved out of the sources
+		if(parse_cache != nullptr && parsed_all_sources){
+			parse_cache->store(source_manager);
 		}
-	}
+	};
 
 
+	// the default depends on the target (which can be different for each request to the server)
+	std::filesystem::path output_path = config.output_path;
 
-	if(config.output_path.empty()){
+	if(output_path.empty()){
 		const char* file_ext = [&]() noexcept {
 			switch(config.target){
 				case Config::Target::LLVMIR: return "ll";
@@ -120,55 +235,52 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 		}();
 
 		if(file_ext != nullptr){
-			config.output_path = config.relative_directory / std::format("{}.{}", config.name, file_ext);
+			output_path = config.relative_directory / std::format("{}.{}", config.name, file_ext);
 		}
 	}
 
 
 
 
+	//////////////////////////////////////////////////////////////////////
+	// get code
 
+	auto file_paths = std::vector<std::filesystem::path>();
 
-	if(config.verbose){
-		printer.info("Panther Compiler\n");
-		printer.trace("----------------\n");
-
-		printer.debug( std::format("Relative Directory: {}\n", config.relative_directory.string()) );
-
-		switch(config.target){
-			break; case Config::Target::PrintTokens:      printer.debug("Target: PrintTokens\n");
-			break; case Config::Target::PrintAST:         printer.debug("Target: PrintAST\n");
-			break; case Config::Target::SemanticAnalysis: printer.debug("Target: SemanticAnalysis\n");
-			break; case Config::Target::PrintLLVMIR:      printer.debug("Target: PrintLLVMIR\n");
-			break; case Config::Target::LLVMIR:           printer.debug("Target: LLVMIR\n");
-			break; case Config::Target::Object:           printer.debug("Target: Object\n");
-			break; case Config::Target::Executable:       printer.debug("Target: Executable\n");
-			break; case Config::Target::Run:              printer.debug("Target: Run\n");
-			break; default: evo::debugFatalBreak("Unknown target");
-		};
-	}
-
-
-	auto source_manager = panther::SourceManager(
-		panther::SourceManager::Config{
-			.basePath = config.relative_directory.string(),
-		},
-		[&](const panther::Message& message){
-			printer.print_message(message);
+	const auto source_loader = panther::cli::SourceLoader(
+		panther::cli::SourceLoader::Config{
+			.numThreads     = config.num_threads,
+			.memoryMapFiles = config.memory_map_files,
 		}
 	);
 
+	time_report.beginPhase("read");
 
+	if(config.source_directory.empty() == false){
+		std::optional<std::vector<std::filesystem::path>> discovered_files =
+			source_loader.discoverFiles((config.relative_directory / config.source_directory).make_preferred());
 
+		if(discovered_files.has_value() == false){
+			printer.error(std::format("Failed to read source directory: {}\n", config.source_directory.string()));
+			exit();
+			return 1;
+		}
 
-	//////////////////////////////////////////////////////////////////////
-	// get code
+		if(discovered_files->empty()){
+			printer.error(std::format("No \".pthr\" files found in source directory: {}\n", config.source_directory.string()));
+			exit();
+			return 1;
+		}
 
-	auto file_paths = std::vector<std::filesystem::path>{
-		(config.relative_directory / "test.pthr").make_preferred(),
-		(config.relative_directory / "test2.pthr").make_preferred(),
-		// (config.relative_directory / "test3.pthr").make_preferred(),
-	};
+		file_paths = std::move(*discovered_files);
+
+	}else{
+		file_paths = std::vector<std::filesystem::path>{
+			(config.relative_directory / "test.pthr").make_preferred(),
+			(config.relative_directory / "test2.pthr").make_preferred(),
+			// (config.relative_directory / "test3.pthr").make_preferred(),
+		};
+	}
 
 	const auto src_config = panther::Source::Config{
 		.allowStructMemberTypeInference = true,
@@ -178,34 +290,50 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 	};
 
 
-	auto file = evo::fs::File{};
-	auto source_ids = std::vector<panther::Source::ID>();
-	for(std::filesystem::path& file_path : file_paths){
-		const bool opened_successfully = file.open(file_path.string(), evo::fs::FileMode::Read);
-		if(opened_successfully == false){
-			printer.error(std::format("Failed to open file: {}\n", file_path.string()));
-			exit();
-			return 1;
-		}
-
-		std::string file_data = file.read().value();
-
-		file.close();
+	evo::Expected<std::vector<panther::Source::ID>, std::vector<std::filesystem::path>> loaded_sources =
+		source_loader.loadFiles(std::move(file_paths), source_manager, src_config);
 
-		source_ids.emplace_back(source_manager.addSource(std::move(file_path), std::move(file_data), src_config));
+	if(loaded_sources.has_value() == false){
+		for(const std::filesystem::path& failed_path : loaded_sources.error()){
+			printer.error(std::format("Failed to open file: {}\n", failed_path.string()));
+		}
+		exit();
+		return 1;
 	}
 
+	const std::vector<panther::Source::ID>& source_ids = loaded_sources.value();
 
 
-	//////////////////////////////////////////////////////////////////////
-	// frontend
-
 	source_manager.lock();
 
 	#if defined(PANTHER_BUILD_DEBUG)
 		printer.trace("source manager locked\n");
 	#endif
 
+	const size_t num_reused_sources = parse_cache != nullptr ? parse_cache->reuse(source_manager) : 0;
+
+
+	// sum of `get_count()` of every source (the source manager must be locked)
+	// 	the counts are only for the time report, so they aren't computed if it wasn't requested
+	const auto count_in_sources = [&](auto get_count) noexcept -> uint64_t {
+		if(config.time_report == false){ return 0; }
+
+		uint64_t total = 0;
+		for(const panther::Source& source : source_manager.getSources()){
+			total += uint64_t(get_count(source));
+		}
+		return total;
+	};
+
+	time_report.endPhase({
+		{"files", source_ids.size()},
+		{"bytes", count_in_sources([](const panther::Source& source) noexcept -> size_t { return source.getData().size(); })},
+	});
+
+
+
+	//////////////////////////////////////////////////////////////////////
+	// frontend
 
 	if(config.verbose){
 		if(source_manager.numSources() > 1){
@@ -217,12 +345,20 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 		for(const panther::Source& source : source_manager.getSources()){
 			printer.trace(std::format("  - \"{}\"\n", source.getLocation().string()));
 		}
+
+		if(parse_cache != nullptr){
+			printer.trace(std::format(
+				"Reused the tokens and AST of {} / {} files\n", num_reused_sources, source_manager.numSources()
+			));
+		}
 	}
 	
 
 	///////////////////////////////////
 	// tokenize
 
+	time_report.beginPhase("tokenize");
+
 	const evo::uint tokenizing_successful = source_manager.tokenize();
 
 	if(tokenizing_successful > 0){
@@ -232,6 +368,11 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 	}
 
 
+	time_report.endPhase({
+		{"tokens", count_in_sources([](const panther::Source& source) noexcept -> size_t { return source.tokens.size(); })},
+	});
+
+
 	if(config.verbose){
 		printer.success("Successfully Tokenized all files\n");
 	}
@@ -252,6 +393,8 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 	///////////////////////////////////
 	// parse
 
+	time_report.beginPhase("parse");
+
 	const evo::uint parsing_successful = source_manager.parse();
 
 	if(parsing_successful > 0){
@@ -262,6 +405,13 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 	}
 
 
+	time_report.endPhase({
+		{"AST nodes", count_in_sources([](const panther::Source& source) noexcept -> size_t { return source.nodes.size(); })},
+	});
+
+
+	parsed_all_sources = true;
+
 	if(config.verbose){
 		printer.success("Successfully Parsed all files\n");
 	}
@@ -285,13 +435,32 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 	source_manager.initIntrinsics();
 
 
-	const evo::uint semantic_analysis_successful = source_manager.semanticAnalysis();
+	// the phases are run one at a time so that each of them can be timed
+	using SemanticAnalysisPhase = panther::SourceManager::SemanticAnalysisPhase;
+	for(
+		const auto& [semantic_analysis_phase, phase_name] : {
+			std::pair(SemanticAnalysisPhase::GlobalIdentsAndImports, "semantic analysis (global idents and imports)"),
+			std::pair(SemanticAnalysisPhase::GlobalAliases,          "semantic analysis (global aliases)"),
+			std::pair(SemanticAnalysisPhase::GlobalTypes,            "semantic analysis (global types)"),
+			std::pair(SemanticAnalysisPhase::GlobalValues,           "semantic analysis (global values)"),
+			std::pair(SemanticAnalysisPhase::Runtime,                "semantic analysis (function bodies)"),
+		}
+	){
+		time_report.beginPhase(phase_name);
 
-	if(semantic_analysis_successful > 0){
-		printer.error( std::format("Semantic Analysis failed for {} / {} files\n", semantic_analysis_successful, source_manager.numSources()) );
+		const evo::uint semantic_analysis_successful = source_manager.semanticAnalysis(semantic_analysis_phase);
 
-		exit();
-		return 1;
+		if(semantic_analysis_successful > 0){
+			printer.error( std::format("Semantic Analysis failed for {} / {} files\n", semantic_analysis_successful, source_manager.numSources()) );
+
+			exit();
+			return 1;
+		}
+
+		time_report.endPhase({
+			{"PIR funcs", count_in_sources([](const panther::Source& source) noexcept -> size_t { return source.pir.funcs.size(); })},
+			{"types", source_manager.numTypes()},
+		});
 	}
 
 
@@ -312,10 +481,43 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 	//////////////////////////////////////////////////////////////////////
 	// lowering to IR
 
+	// walks every instruction of the module, so only for the time report (like `count_in_sources`)
+	const auto num_llvm_instructions = [&]() noexcept -> uint64_t {
+		if(config.time_report == false){ return 0; }
+		return pir_to_llvmir.getNumLLVMInstructions();
+	};
+
+	time_report.beginPhase("lowering");
+
 	llvm_context.init();
 
+	// names of values are only needed to read the IR (or to debug the compiler)
+	#if !defined(PANTHER_BUILD_DEBUG)
+		if(config.target != Config::Target::PrintLLVMIR && config.target != Config::Target::LLVMIR){
+			llvm_context.setDiscardValueNames(true);
+		}
+	#endif
+
+
+	const std::string pir_to_llvmir_init_err = pir_to_llvmir.init(
+		config.name,
+		llvm_context,
+		config.target_triple,
+		panther::llvmint::TargetConfig{
+			.cpu        = config.target_cpu,
+			.features   = config.target_features,
+			.relocModel = config.reloc_model,
+			.codeModel  = config.code_model,
+		},
+		config.opt_level
+	);
+
+	if(pir_to_llvmir_init_err.empty() == false){
+		printer.error( std::format("Failed to set target: {}\n", pir_to_llvmir_init_err) );
+		exit();
+		return 1;
+	}
 
-	pir_to_llvmir.init(config.name, llvm_context);
 	pir_to_llvmir.initLibC();
 
 	pir_to_llvmir.lower(source_manager);
@@ -330,6 +532,20 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 		if(config.verbose){ printer.success("Added Panther runtime to LLVM IR\n"); }
 	}
 
+	time_report.endPhase({{"LLVM instructions", num_llvm_instructions()}});
+
+
+	// with the object cache, each source is optimized after the module is split
+	const bool use_object_cache = config.target == Config::Target::Executable && config.object_cache_directory.empty() == false;
+
+	if(use_object_cache == false){
+		time_report.beginPhase("optimization");
+		pir_to_llvmir.optimize();
+		time_report.endPhase({{"LLVM instructions", num_llvm_instructions()}});
+
+		if(config.verbose){ printer.success(std::format("Optimized LLVM IR (O{})\n", evo::uint(config.opt_level))); }
+	}
+
 
 
 
@@ -347,7 +563,7 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 		pir_to_llvmir.shutdown();
 
 
-		const std::string path_str = config.output_path.string();
+		const std::string path_str = output_path.string();
 
 		auto output_file = evo::fs::File();
 		if(output_file.open(path_str, evo::fs::FileMode::Write) == false){
@@ -375,6 +591,8 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 		return 0;
 
 	}else if(config.target == Config::Target::Object){
+		time_report.beginPhase("codegen");
+
 		const evo::Result<std::vector<evo::byte>> output = pir_to_llvmir.compileToObjectFile();
 		if(output.isError()){
 			printer.fatal("Target machine cannot output object file");
@@ -382,9 +600,11 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 			return 1;
 		}
 
+		time_report.endPhase({{"bytes", output.value().size()}});
+
 		pir_to_llvmir.shutdown();
 
-		const std::string path_str = config.output_path.string();
+		const std::string path_str = output_path.string();
 
 		auto output_file = evo::fs::BinaryFile();
 		if(output_file.open(path_str, evo::fs::FileMode::Write) == false){
@@ -425,7 +645,9 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 	if(config.target == Config::Target::Run){
 		if(config.verbose){ printer.trace("------------------------------\nRunning:\n"); }
 
-		const uint64_t return_code = pir_to_llvmir.run<uint64_t>("main");
+		time_report.beginPhase("JIT (compile and run)");
+		const uint64_t return_code = pir_to_llvmir.run<uint64_t>("main", config.jit_compile_threads);
+		time_report.endPhase();
 
 		// if(config.verbose){ printer.trace("------------------------------\n"); }
 
@@ -437,52 +659,110 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 	}else if(config.target == Config::Target::Executable){
 
 		///////////////////////////////////
-		// create object file
+		// create object files
 
-		const evo::Result<std::vector<evo::byte>> output = pir_to_llvmir.compileToObjectFile();
-		if(output.isError()){
-			printer.fatal("Target machine cannot output object file");
-			exit();
-			return 1;
-		}
+		// includes optimization when using the object cache
+		time_report.beginPhase("codegen");
 
-		pir_to_llvmir.shutdown();
+		auto object_files = std::vector<std::vector<evo::byte>>();
+		evo::uint num_cached = 0;
 
+		if(use_object_cache == false){
+			evo::Result<std::vector<std::vector<evo::byte>>> output = pir_to_llvmir.compileToObjectFiles(config.codegen_partitions);
+			if(output.isError()){
+				printer.fatal("Target machine cannot output object file");
+				exit();
+				return 1;
+			}
 
-		///////////////////////////////////
-		// write object file
+			object_files = std::move(output.value());
 
-		// TODO: better output path for obj_path_str
-		const std::string obj_path_str = (config.relative_directory / (config.name + ".o")).string();
-		const std::string path_str = config.output_path.string();
+		}else{
+			const auto object_cache = panther::cli::ObjectCache(config.relative_directory / config.object_cache_directory);
 
+			std::vector<std::unique_ptr<panther::llvmint::Module>> modules = pir_to_llvmir.splitBySource(source_manager);
 
-		auto output_file = evo::fs::BinaryFile();
-		if(output_file.open(obj_path_str, evo::fs::FileMode::Write) == false){
-			printer.error( std::format("Failed to open file: \"{}\"\n", obj_path_str) );
-			exit();
-			return 1;
-		}
+			auto cache_keys = std::vector<std::string>();
+			cache_keys.reserve(modules.size());
 
-		if(output_file.write(output.value()) == false){
-			printer.error( std::format("Failed to write to file: \"{}\"\n", obj_path_str) );
-			exit();
-			return 1;
+			for(std::unique_ptr<panther::llvmint::Module>& module : modules){
+				const std::string& cache_key = cache_keys.emplace_back(module->hash());
+
+				std::optional<std::vector<evo::byte>> cached_object_file = object_cache.load(cache_key);
+				if(cached_object_file.has_value()){
+					object_files.emplace_back(std::move(*cached_object_file));
+					num_cached += 1;
+					continue;
+				}
+
+				module->optimize(config.opt_level);
+
+				evo::Result<std::vector<evo::byte>> object_file = module->compileToObjectFile();
+				if(object_file.isError()){
+					printer.fatal("Target machine cannot output object file");
+					modules.clear(); // must be destroyed before the LLVM context
+					exit();
+					return 1;
+				}
+
+				if(object_cache.store(cache_key, object_file.value()) == false){
+					printer.warning(std::format("Failed to store object file in cache: \"{}\"\n", cache_key));
+				}
+
+				object_files.emplace_back(std::move(object_file.value()));
+			}
+
+			if(config.verbose){
+				printer.success(
+					std::format("Generated object files (O{}, {} of {} from cache)\n", evo::uint(config.opt_level), num_cached, modules.size())
+				);
+			}
+
+			if(config.object_cache_max_size != 0){
+				const size_t num_evicted = object_cache.evict(config.object_cache_max_size, cache_keys);
+
+				if(config.verbose && num_evicted > 0){
+					printer.info(std::format("Removed {} least recently used object files from the cache\n", num_evicted));
+				}
+			}
 		}
 
-		output_file.close();
+		pir_to_llvmir.shutdown();
 
-		if(config.verbose){
-			printer.success( std::format("Successfully wrote object file to: \"{}\"\n", obj_path_str) );
+		uint64_t num_object_file_bytes = 0;
+		for(const std::vector<evo::byte>& object_file : object_files){
+			num_object_file_bytes += object_file.size();
 		}
 
+		time_report.endPhase({
+			{"object files", object_files.size()},
+			{"cached object files", num_cached},
+			{"bytes", num_object_file_bytes},
+		});
+
 
 		///////////////////////////////////
 		// link / create executable
 
-		auto lld_interface = panther::LLDInterface();
+		time_report.beginPhase("link");
+
+		const std::string path_str = output_path.string();
 
-		const panther::LLDInterface::LinkerOutput linking_result = lld_interface.link(obj_path_str, path_str, panther::LLDInterface::Linker::WinLink);
+		const std::string target_triple = config.target_triple.empty()
+			? panther::llvmint::Module::getDefaultTargetTriple()
+			: config.target_triple;
+
+		auto lld_interface = panther::LLDInterface(
+			panther::LLDInterface::Config{
+				.targetTriple = target_triple,
+				.pie          = config.reloc_model == panther::llvmint::RelocModel::PIC,
+				.numThreads   = config.num_threads,
+			}
+		);
+
+		const panther::LLDInterface::LinkerOutput linking_result = lld_interface.linkInMemory(
+			object_files, path_str, panther::LLDInterface::getLinker(target_triple)
+		);
 
 		if(linking_result.succeeded() == false){
 			for(const std::string& link_err_msg : linking_result.err_messages){
@@ -496,6 +776,8 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 			return 1;	
 		}
 
+		time_report.endPhase();
+
 		if(config.verbose){
 			printer.success( std::format("Successfully wrote output to: \"{}\"\n", path_str) );
 		}
@@ -512,4 +794,203 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexce
 
 	exit();
 	return 0;
-}
\ No newline at end of file
+};
+
+
+
+// returns nullopt if `name` isn't the name of a target
+static auto get_target(std::string_view name) noexcept -> std::optional<Config::Target> {
+	if(name == "PrintTokens"){      return Config::Target::PrintTokens; }
+	if(name == "PrintAST"){         return Config::Target::PrintAST; }
+	if(name == "SemanticAnalysis"){ return Config::Target::SemanticAnalysis; }
+	if(name == "PrintLLVMIR"){      return Config::Target::PrintLLVMIR; }
+	if(name == "LLVMIR"){           return Config::Target::LLVMIR; }
+	if(name == "Object"){           return Config::Target::Object; }
+	if(name == "Executable"){       return Config::Target::Executable; }
+	if(name == "Run"){              return Config::Target::Run; }
+
+	return std::nullopt;
+};
+
+
+// compiles for each request received on `config.server_socket_path` until a "shutdown" request
+// 	(see Config::server_socket_path for the protocol)
+// 	everything from starting the process is kept between requests (like the initialization of LLVM),
+// 	and the tokens and AST of sources that didn't change are reused,
+// 	but each request is analyzed from the sources again since sources depend on each other
+// 	(with `object_cache_directory` set, only the sources that changed need machine code to be generated again)
+// returns the exit code
+static auto run_server(const Config& config, panther::cli::Printer& printer) noexcept -> int {
+	const std::filesystem::path socket_path = config.relative_directory / config.server_socket_path;
+
+	auto server = panther::cli::Server();
+	if(server.open(socket_path) == false){
+		printer.error(std::format("Failed to open server socket: \"{}\"\n", socket_path.string()));
+		return 1;
+	}
+
+	if(config.verbose){
+		printer.info(std::format("Waiting for compile requests on: \"{}\"\n", socket_path.string()));
+	}
+
+	auto parse_cache = panther::cli::ParseCache();
+
+	// accepting keeps failing until the cause goes away (like running out of file descriptors),
+	// 	so the server waits longer after each failure in a row instead of spinning, and shuts down if it doesn't stop
+	static constexpr uint32_t MAX_ACCEPT_FAILURES = 20;
+	static constexpr uint32_t MAX_ACCEPT_RETRY_DELAY_MS = 1000;
+	uint32_t num_accept_failures = 0;
+
+	int server_exit_code = 0;
+
+
+	while(true){
+		using RequestError = panther::cli::Server::RequestError;
+
+		const evo::Expected<std::string, RequestError> request_result = server.waitForRequest();
+		if(request_result.has_value() == false){
+			if(request_result.error() == RequestError::ReceiveFailed){
+				printer.error("Failed to receive compile request\n");
+				continue;
+			}
+
+			num_accept_failures += 1;
+
+			if(num_accept_failures == MAX_ACCEPT_FAILURES){
+				printer.error(std::format("Failed to accept a connection {} times in a row, shutting down\n", num_accept_failures));
+				server_exit_code = 1;
+				break;
+			}
+
+			const uint32_t retry_delay_ms = std::min(uint32_t(10) << (num_accept_failures - 1), MAX_ACCEPT_RETRY_DELAY_MS);
+			printer.error(std::format("Failed to accept a connection (retrying in {} ms)\n", retry_delay_ms));
+			std::this_thread::sleep_for(std::chrono::milliseconds(retry_delay_ms));
+			continue;
+		}
+
+		num_accept_failures = 0;
+
+		const std::string& request = request_result.value();
+
+		if(request == "shutdown"){
+			server.respond("0\n");
+			break;
+		}
+
+
+		Config request_config = config;
+
+		if(request.empty() == false){
+			const std::optional<Config::Target> target = get_target(request);
+			if(target.has_value() == false){
+				server.respond(std::format("1\nUnknown target: \"{}\"\n", request));
+				continue;
+			}
+
+			request_config.target = *target;
+		}
+
+		// the program would be run by the JIT inside of the server, so it could crash or hang the server
+		if(request_config.target == Config::Target::Run){
+			server.respond("1\nThe Run target is not supported by the server\n");
+			continue;
+		}
+
+		// so that the trace written by each request only has that request
+		if(panther::Trace::isEnabled()){ panther::Trace::clear(); }
+
+		auto output = std::string();
+		auto request_printer = panther::cli::Printer(output);
+
+		const int exit_code = compile(request_config, request_printer, &parse_cache);
+
+		server.respond(std::format("{}\n{}", exit_code, output));
+
+		if(config.verbose){
+			printer.trace(std::format("Compiled request \"{}\" (exit code: {})\n", request, exit_code));
+		}
+	}
+
+
+	server.close();
+
+	if(config.verbose){ printer.info("Server shut down\n"); }
+
+	return server_exit_code;
+};
+
+
+auto main([[maybe_unused]] int argc, [[maybe_unused]] const char* args[]) noexcept -> int {
+	auto config = Config{
+		.name		  = "testing",
+		.print_colors = true,
+		.verbose      = true,
+		.target       = Config::Target::Run,
+	};
+
+
+	// print UTF-8 characters on windows
+	#if defined(EVO_PLATFORM_WINDOWS)
+		::SetConsoleOutputCP(CP_UTF8);
+	#endif
+	
+
+	auto printer = panther::cli::Printer(config.print_colors);
+
+	if(config.trace_output_path.empty() == false){
+		panther::Trace::enable();
+	}
+
+
+	auto exit = [&](){
+		#if !defined(PANTHER_BUILD_DIST) && defined(EVO_COMPILER_MSVC)
+			printer.trace("Press Enter to close...\n");
+			std::cin.get();
+		#endif
+	};
+
+
+	if(config.relative_directory_set == false){
+		std::error_code ec;
+		config.relative_directory = std::filesystem::current_path(ec);
+		if(ec){
+			printer.error("Failed to get relative directory\n");
+			printer.error(std::format("\tcode: \"{}\"\n", ec.value()));
+			printer.error(std::format("\tmessage: \"{}\"\n", ec.message()));
+
+			exit();
+			return 1;
+		}
+	}
+
+
+
+	if(config.verbose){
+		printer.info("Panther Compiler\n");
+		printer.trace("----------------\n");
+
+		printer.debug( std::format("Relative Directory: {}\n", config.relative_directory.string()) );
+		printer.debug( std::format("Optimization Level: O{}\n", evo::uint(config.opt_level)) );
+		printer.debug( std::format("Target CPU: {}\n", config.target_cpu) );
+
+		switch(config.target){
+			break; case Config::Target::PrintTokens:      printer.debug("Target: PrintTokens\n");
+			break; case Config::Target::PrintAST:         printer.debug("Target: PrintAST\n");
+			break; case Config::Target::SemanticAnalysis: printer.debug("Target: SemanticAnalysis\n");
+			break; case Config::Target::PrintLLVMIR:      printer.debug("Target: PrintLLVMIR\n");
+			break; case Config::Target::LLVMIR:           printer.debug("Target: LLVMIR\n");
+			break; case Config::Target::Object:           printer.debug("Target: Object\n");
+			break; case Config::Target::Executable:       printer.debug("Target: Executable\n");
+			break; case Config::Target::Run:              printer.debug("Target: Run\n");
+			break; default: evo::debugFatalBreak("Unknown target");
+		};
+	}
+
+
+	const int exit_code = config.server_socket_path.empty()
+		? compile(config, printer)
+		: run_server(config, printer);
+
+	exit();
+	return exit_code;
+};
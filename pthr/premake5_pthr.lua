@@ -30,6 +30,12 @@ project "pthr"
 		"LLD_interface",
 	}
 
+	filter "system:Windows"
+		links {
+			"Ws2_32.lib"
+		}
+	filter {}
+
 
 
 
@@ -3,6 +3,16 @@
 #include <LLVM.h>
 #include <lld/common/Driver.h>
 
+#include <array>
+#include <deque>
+#include <filesystem>
+#include <random>
+
+#if defined(EVO_PLATFORM_LINUX)
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
 LLD_HAS_DRIVER(coff)
 LLD_HAS_DRIVER(elf)
 LLD_HAS_DRIVER(mingw)
@@ -51,9 +61,114 @@ namespace panther{
    
 
 
+    // directory that has the C runtime objects (`start_file_name`, crti.o, crtn.o) and libc of `target_triple`
+    static auto find_libc_directory(const llvm::Triple& target_triple, std::string_view start_file_name) noexcept
+    -> std::optional<std::filesystem::path> {
+        // for example: "x86_64-linux-gnu" or "x86_64-linux-musl"
+        const std::string multiarch_name = std::format(
+            "{}-linux-{}", target_triple.getArchName().str(), target_triple.getEnvironmentName().str()
+        );
+
+        const auto candidate_directories = std::array<std::filesystem::path, 5>{
+            std::filesystem::path("/usr/lib") / multiarch_name,
+            std::filesystem::path("/lib") / multiarch_name,
+            std::filesystem::path(target_triple.isArch64Bit() ? "/usr/lib64" : "/usr/lib32"),
+            std::filesystem::path(target_triple.isArch64Bit() ? "/lib64" : "/lib32"),
+            std::filesystem::path("/usr/lib"),
+        };
+
+        for(const std::filesystem::path& candidate_directory : candidate_directories){
+            std::error_code ec;
+            if(std::filesystem::exists(candidate_directory / start_file_name, ec)){
+                return candidate_directory;
+            }
+        }
+
+        return std::nullopt;
+    };
+
+
+    // directory of the newest GCC for `target_triple` that has `crtbegin_file_name` (crtbegin.o / crtend.o are part of GCC)
+    // 	(for example: "/usr/lib/gcc/x86_64-linux-gnu/12")
+    static auto find_gcc_crt_directory(const llvm::Triple& target_triple, std::string_view crtbegin_file_name) noexcept
+    -> std::optional<std::filesystem::path> {
+        auto gcc_crt_directory = std::optional<std::filesystem::path>();
+        auto gcc_version = llvm::VersionTuple();
+
+        for(const char* gcc_directory : {"/usr/lib/gcc", "/usr/lib64/gcc"}){
+            std::error_code ec;
+            for(const std::filesystem::directory_entry& triple_entry : std::filesystem::directory_iterator(gcc_directory, ec)){
+                // the vendor differs between distributions (for example: "x86_64-pc-linux-gnu", "x86_64-alpine-linux-musl")
+                const auto gcc_triple = llvm::Triple(triple_entry.path().filename().string());
+                if(gcc_triple.getArch() != target_triple.getArch() || gcc_triple.isMusl() != target_triple.isMusl()){
+                    continue;
+                }
+
+                for(const std::filesystem::directory_entry& version_entry : std::filesystem::directory_iterator(triple_entry.path(), ec)){
+                    auto version = llvm::VersionTuple();
+                    if(version.tryParse(version_entry.path().filename().string())){ continue; } // returns true if invalid
+                    if(gcc_crt_directory.has_value() && version <= gcc_version){ continue; }
+
+                    if(std::filesystem::exists(version_entry.path() / crtbegin_file_name, ec)){
+                        gcc_crt_directory = version_entry.path();
+                        gcc_version = version;
+                    }
+                }
+            }
+        }
+
+        return gcc_crt_directory;
+    };
+
+
+    // returns nullptr if the dynamic linker of `target_triple` isn't known (lld uses its default)
+    static auto get_dynamic_linker(const llvm::Triple& target_triple) noexcept -> const char* {
+        if(target_triple.isMusl()){
+            switch(target_triple.getArch()){
+                case llvm::Triple::x86_64:  return "/lib/ld-musl-x86_64.so.1";
+                case llvm::Triple::x86:     return "/lib/ld-musl-i386.so.1";
+                case llvm::Triple::aarch64: return "/lib/ld-musl-aarch64.so.1";
+                case llvm::Triple::riscv64: return "/lib/ld-musl-riscv64.so.1";
+                default: return nullptr;
+            };
+        }
+
+        switch(target_triple.getArch()){
+            case llvm::Triple::x86_64:  return "/lib64/ld-linux-x86-64.so.2";
+            case llvm::Triple::x86:     return "/lib/ld-linux.so.2";
+            case llvm::Triple::aarch64: return "/lib/ld-linux-aarch64.so.1";
+            case llvm::Triple::riscv64: return "/lib/ld-linux-riscv64-lp64d.so.1";
+            default: return nullptr;
+        };
+    };
+
+
+
+    auto LLDInterface::getLinker(std::string_view target_triple) noexcept -> Linker {
+        const auto triple = llvm::Triple(target_triple);
+
+        if(triple.isOSWindows()){
+            return triple.isWindowsGNUEnvironment() ? Linker::MinGW : Linker::WinLink;
+        }
+
+        if(triple.isOSDarwin()){ return Linker::Darwin; }
+        if(triple.isOSBinFormatWasm()){ return Linker::Wasm; }
+
+        return Linker::Gnu;
+    };
+
+
+
     auto LLDInterface::link(const std::string& input_file_path, const std::string& target_output, Linker linker) noexcept -> LinkerOutput {
+        return this->link(std::span<const std::string>(&input_file_path, 1), target_output, linker);
+    };
+
+
+    auto LLDInterface::link(std::span<const std::string> input_file_paths, const std::string& target_output, Linker linker) noexcept
+    -> LinkerOutput {
         auto args = std::vector<const char*>{};
-        auto str_alloc = std::vector<std::string>{};
+        auto trailing_args = std::vector<const char*>{}; // args that go after the input files
+        auto str_alloc = std::deque<std::string>{}; // deque so that adding strings doesn't move the ones in `args`
         auto driver = std::optional<lld::DriverDef>();
 
         switch(linker){
@@ -80,8 +195,71 @@ namespace panther{
             } break;
 
             case Linker::Gnu: {
-                // TODO: better messaging
-                evo::debugFatalBreak("Gnu Not supported");
+                const auto target_triple = llvm::Triple(this->config.targetTriple);
+
+                // position independent executables need the position independent versions of the C runtime objects
+                const std::string_view start_file_name = this->config.pie ? "Scrt1.o" : "crt1.o";
+                const std::string_view crtbegin_file_name = this->config.pie ? "crtbeginS.o" : "crtbegin.o";
+                const std::string_view crtend_file_name = this->config.pie ? "crtendS.o" : "crtend.o";
+
+                const std::optional<std::filesystem::path> libc_directory = find_libc_directory(target_triple, start_file_name);
+                if(libc_directory.has_value() == false){
+                    return {1, true, {std::format("Failed to find the C runtime ({}) for target \"{}\"\n", start_file_name, this->config.targetTriple)}};
+                }
+
+                // not every system has GCC (these are only needed for code that uses .ctors / .dtors or registers frames)
+                const std::optional<std::filesystem::path> gcc_crt_directory = find_gcc_crt_directory(target_triple, crtbegin_file_name);
+
+                const auto store_arg = [&](std::string&& arg) noexcept -> const char* {
+                    return str_alloc.emplace_back(std::move(arg)).c_str();
+                };
+
+
+                args.emplace_back("ld.lld");
+
+                args.emplace_back("-o");
+                args.emplace_back(target_output.c_str());
+
+                args.emplace_back("--eh-frame-hdr");
+
+                if(this->config.pie){
+                    args.emplace_back("-pie");
+                }else{
+                    args.emplace_back("-no-pie");
+                }
+
+                const char* dynamic_linker = get_dynamic_linker(target_triple);
+                if(dynamic_linker != nullptr){
+                    args.emplace_back("-dynamic-linker");
+                    args.emplace_back(dynamic_linker);
+                }
+
+                // remove unreferenced sections (every function / global is in its own section),
+                // 	fold identical functions, and merge strings
+                args.emplace_back("--gc-sections");
+                args.emplace_back("--icf=all");
+                args.emplace_back("-O2");
+
+                if(this->config.numThreads != 0){
+                    args.emplace_back(store_arg(std::format("--threads={}", this->config.numThreads)));
+                }
+
+                args.emplace_back(store_arg(std::format("-L{}", libc_directory->string())));
+
+                args.emplace_back(store_arg((*libc_directory / start_file_name).string()));
+                args.emplace_back(store_arg((*libc_directory / "crti.o").string()));
+                if(gcc_crt_directory.has_value()){
+                    args.emplace_back(store_arg((*gcc_crt_directory / crtbegin_file_name).string()));
+                }
+
+                trailing_args.emplace_back("-lc");
+                if(gcc_crt_directory.has_value()){
+                    trailing_args.emplace_back(store_arg((*gcc_crt_directory / crtend_file_name).string()));
+                }
+                trailing_args.emplace_back(store_arg((*libc_directory / "crtn.o").string()));
+
+
+                driver = lld::DriverDef(lld::Gnu, &lld::elf::link);
             } break;
 
             case Linker::MinGW: {
@@ -100,7 +278,13 @@ namespace panther{
             } break;
         };
 
-        args.emplace_back(input_file_path.c_str());
+        for(const std::string& input_file_path : input_file_paths){
+            args.emplace_back(input_file_path.c_str());
+        }
+
+        for(const char* trailing_arg : trailing_args){
+            args.emplace_back(trailing_arg);
+        }
 
         
         evo::debugAssert(driver.has_value(), "linker driver not set");
@@ -116,4 +300,104 @@ namespace panther{
     };
 
 
+
+
+
+    #if defined(EVO_PLATFORM_LINUX)
+
+        // each object file is put in an anonymous in-memory file that lld reads through /proc/self/fd
+        auto LLDInterface::linkInMemory(
+            std::span<const std::vector<evo::byte>> object_files, const std::string& target_output, Linker linker
+        ) noexcept -> LinkerOutput {
+            auto file_descriptors = std::vector<int>();
+            auto input_file_paths = std::vector<std::string>();
+
+            const auto close_files = [&]() noexcept -> void {
+                for(int file_descriptor : file_descriptors){
+                    ::close(file_descriptor);
+                }
+            };
+
+            for(const std::vector<evo::byte>& object_file : object_files){
+                const int file_descriptor = ::memfd_create("panther-object", MFD_CLOEXEC);
+                if(file_descriptor == -1){
+                    close_files();
+                    return {1, true, {"Failed to create in-memory object file\n"}};
+                }
+                file_descriptors.emplace_back(file_descriptor);
+
+                size_t num_written = 0;
+                while(num_written < object_file.size()){
+                    const ssize_t write_result =
+                        ::write(file_descriptor, object_file.data() + num_written, object_file.size() - num_written);
+
+                    if(write_result == -1){
+                        close_files();
+                        return {1, true, {"Failed to write in-memory object file\n"}};
+                    }
+
+                    num_written += size_t(write_result);
+                }
+
+                input_file_paths.emplace_back(std::format("/proc/self/fd/{}", file_descriptor));
+            }
+
+            LinkerOutput output = this->link(input_file_paths, target_output, linker);
+
+            close_files();
+
+            return output;
+        };
+
+    #else
+
+        auto LLDInterface::linkInMemory(
+            std::span<const std::vector<evo::byte>> object_files, const std::string& target_output, Linker linker
+        ) noexcept -> LinkerOutput {
+            std::error_code ec;
+            const std::filesystem::path temp_directory = std::filesystem::temp_directory_path(ec);
+            if(ec){
+                return {1, true, {"Failed to get temp directory\n"}};
+            }
+
+            // random so that multiple compilations at the same time don't use the same files
+            const uint64_t file_id = (uint64_t(std::random_device()()) << 32) | uint64_t(std::random_device()());
+
+            auto input_file_paths = std::vector<std::string>();
+
+            const auto remove_files = [&]() noexcept -> void {
+                for(const std::string& input_file_path : input_file_paths){
+                    std::filesystem::remove(input_file_path, ec);
+                }
+            };
+
+            for(size_t i = 0; i < object_files.size(); i+=1){
+                const std::string input_file_path = (temp_directory / std::format("panther-{:x}-{}.o", file_id, i)).string();
+
+                auto object_file = evo::fs::BinaryFile();
+                if(object_file.open(input_file_path, evo::fs::FileMode::Write) == false){
+                    remove_files();
+                    return {1, true, {std::format("Failed to open file: \"{}\"\n", input_file_path)}};
+                }
+                input_file_paths.emplace_back(input_file_path);
+
+                if(object_file.write(object_files[i]) == false){
+                    object_file.close();
+                    remove_files();
+                    return {1, true, {std::format("Failed to write to file: \"{}\"\n", input_file_path)}};
+                }
+
+                object_file.close();
+            }
+
+            LinkerOutput output = this->link(input_file_paths, target_output, linker);
+
+            remove_files();
+
+            return output;
+        };
+
+    #endif
+
+
 };
\ No newline at end of file
@@ -10,9 +10,6 @@ namespace panther{
 		auto Context::init() noexcept -> void {
 			evo::debugAssert(this->isInitialized() == false, "Context is already initialized");
 
-			// LLVMLinkInInterpreter();
-			// auto force = ForceMCJITLinking();
-			LLVMLinkInMCJIT();
 			llvm::InitializeNativeTarget();
 			llvm::InitializeNativeTargetAsmPrinter();
 			llvm::InitializeNativeTargetAsmParser();
@@ -25,7 +22,7 @@ namespace panther{
 			// llvm::InitializeAllAsmPrinters();
 
 
-			this->context = new llvm::LLVMContext();
+			this->context = new llvm::orc::ThreadSafeContext(std::make_unique<llvm::LLVMContext>());
 		};
 
 
@@ -37,6 +34,23 @@ namespace panther{
 			this->context = nullptr;
 		};
 
+
+		auto Context::getContext() noexcept -> llvm::LLVMContext& {
+			evo::debugAssert(this->isInitialized(), "Cannot get context when not initialized");
+			return *this->context->getContext();
+		};
+
+
+		auto Context::setDiscardValueNames(bool discard) noexcept -> void {
+			evo::debugAssert(this->isInitialized(), "Cannot set to discard value names when not initialized");
+			this->context->getContext()->setDiscardValueNames(discard);
+		};
+
+		auto Context::shouldDiscardValueNames() const noexcept -> bool {
+			evo::debugAssert(this->isInitialized(), "Cannot check to discard value names when not initialized");
+			return this->context->getContext()->shouldDiscardValueNames();
+		};
+
 	
 	};
 };
\ No newline at end of file
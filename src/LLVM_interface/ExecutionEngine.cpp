@@ -2,6 +2,7 @@
 
 #include <LLVM.h>
 
+#include "LLVM_interface/Context.h"
 #include "LLVM_interface/Module.h"
 
 
@@ -9,25 +10,72 @@ namespace panther{
 	namespace llvmint{
 		
 		
-		auto ExecutionEngine::createEngine(const Module& module) noexcept -> void {
+		auto ExecutionEngine::createEngine(Module& module, Context& context, evo::uint num_compile_threads) noexcept
+		-> std::string {
 			evo::debugAssert(this->hasCreatedEngine() == false, "Execution engine already created");
 
-			this->engine = llvm::EngineBuilder(module.get_clone()).setEngineKind(llvm::EngineKind::JIT).create();
+			// use the same target as the module was lowered for
+			const llvm::TargetMachine& target_machine = *module.target_machine;
+
+			auto target_features = std::vector<std::string>();
+			for(llvm::StringRef feature : llvm::split(target_machine.getTargetFeatureString(), ',')){
+				if(feature.empty() == false){ target_features.emplace_back(feature); }
+			}
+
+			auto target_machine_builder = llvm::orc::JITTargetMachineBuilder(target_machine.getTargetTriple());
+			target_machine_builder.setCPU(std::string(target_machine.getTargetCPU()));
+			target_machine_builder.addFeatures(target_features);
+			target_machine_builder.setCodeGenOptLevel(target_machine.getOptLevel());
+
+
+			llvm::Expected<std::unique_ptr<llvm::orc::LLLazyJIT>> jit = llvm::orc::LLLazyJITBuilder()
+				.setJITTargetMachineBuilder(std::move(target_machine_builder))
+				.setNumCompileThreads(num_compile_threads)
+				.create();
+
+			if(bool(jit) == false){
+				return llvm::toString(jit.takeError());
+			}
+
+			this->jit = jit->release();
+
+
+			// allows calling functions of the process (libc)
+			llvm::Expected<std::unique_ptr<llvm::orc::DynamicLibrarySearchGenerator>> process_symbols =
+				llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(this->jit->getDataLayout().getGlobalPrefix());
+
+			if(bool(process_symbols) == false){
+				return llvm::toString(process_symbols.takeError());
+			}
+
+			this->jit->getMainJITDylib().addGenerator(std::move(*process_symbols));
+
+
+			auto thread_safe_module = llvm::orc::ThreadSafeModule(module.release(), *context.context);
+			if(llvm::Error error = this->jit->addLazyIRModule(std::move(thread_safe_module))){
+				return llvm::toString(std::move(error));
+			}
+
+			return std::string();
 		};
 
 
 		auto ExecutionEngine::shutdownEngine() noexcept -> void {
 			evo::debugAssert(this->hasCreatedEngine(), "Execution engine is not created and cannot be shutdown");
 
-			delete this->engine;
-			this->engine = nullptr;
+			delete this->jit;
+			this->jit = nullptr;
 		};
 
 
 
 		auto ExecutionEngine::getFuncAddress(std::string_view func_name) noexcept -> uint64_t {
-			const std::string func_name_str = std::string(func_name);
-			return this->engine->getFunctionAddress(func_name_str);
+			llvm::Expected<llvm::orc::ExecutorAddr> func_addr = this->jit->lookup(func_name);
+			if(bool(func_addr) == false){
+				evo::fatalBreak(llvm::toString(func_addr.takeError()));
+			}
+
+			return func_addr->getValue();
 		};
 
 
@@ -43,6 +43,15 @@ namespace panther{
 			return this->createAlloca(type, nullptr, name);
 		};
 
+		auto IRBuilder::createEntryBlockAlloca(llvm::Type* type, evo::CStrProxy name) noexcept -> llvm::AllocaInst* {
+			llvm::BasicBlock& entry_block = this->builder->GetInsertBlock()->getParent()->getEntryBlock();
+			evo::debugAssert(entry_block.getTerminator() != nullptr, "entry block must have a terminator");
+
+			const llvm::IRBuilderBase::InsertPointGuard insert_point_guard{*this->builder};
+			this->builder->SetInsertPoint(entry_block.getTerminator());
+			return this->createAlloca(type, name);
+		};
+
 
 		auto IRBuilder::createLoad(llvm::Value* value, llvm::Type* type, evo::CStrProxy name) noexcept -> llvm::LoadInst* {
 			return this->builder->CreateLoad(type, value, name.c_str());
@@ -103,6 +112,9 @@ namespace panther{
 			llvm::CallInst* call_inst = this->builder->CreateCall(func, llvm::ArrayRef<llvm::Value*>{params.data(), params.size()}, name.c_str());
 			call_inst->setDoesNotThrow();
 
+			// mismatched calling conventions are undefined behavior (and get optimized into `unreachable`)
+			call_inst->setCallingConv(func->getCallingConv());
+
 			return call_inst;
 		};
 
@@ -266,8 +278,8 @@ namespace panther{
 
 
 
-		auto IRBuilder::valueString(evo::CStrProxy str, evo::CStrProxy name) noexcept -> llvm::GlobalVariable* {
-			return this->builder->CreateGlobalString(str.c_str(), name.c_str());;
+		auto IRBuilder::valueString(llvmint::Module& module, evo::CStrProxy str, evo::CStrProxy name) noexcept -> llvm::GlobalVariable* {
+			return this->builder->CreateGlobalString(str.c_str(), name.c_str(), 0, &module.getModule());
 		};
 
 
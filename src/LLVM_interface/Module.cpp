@@ -2,6 +2,8 @@
 
 #include <LLVM.h>
 
+#include "Trace.h"
+
 
 namespace panther{
 	namespace llvmint{
@@ -58,6 +60,15 @@ namespace panther{
 		auto Module::getTypeSize(llvm::Type* type) const noexcept -> uint64_t {
 		    return this->module->getDataLayout().getTypeAllocSize(type).getFixedValue();
 		};
+
+
+		auto Module::getNumInstructions() const noexcept -> size_t {
+			size_t num_instructions = 0;
+			for(const llvm::Function& func : *this->module){
+				num_instructions += func.getInstructionCount();
+			}
+			return num_instructions;
+		};
 		
 
 
@@ -84,7 +95,9 @@ namespace panther{
 		};
 
 
-		auto Module::setDataLayout(const std::string& target_triple, std::string_view cpu, std::string_view features) noexcept -> std::string {
+		auto Module::setDataLayout(
+			const std::string& target_triple, const TargetConfig& target_config, OptLevel opt_level
+		) noexcept -> std::string {
 			auto error_msg = std::string();
 			const llvm::Target* target = llvm::TargetRegistry::lookupTarget(target_triple, error_msg);
 
@@ -93,18 +106,192 @@ namespace panther{
 			}
 
 
+			const llvm::CodeGenOptLevel codegen_opt_level = [&]() noexcept {
+				switch(opt_level){
+					case OptLevel::O0: return llvm::CodeGenOptLevel::None;
+					case OptLevel::O1: return llvm::CodeGenOptLevel::Less;
+					case OptLevel::O2: return llvm::CodeGenOptLevel::Default;
+					case OptLevel::O3: return llvm::CodeGenOptLevel::Aggressive;
+					default: evo::debugFatalBreak("Unknown optimization level");
+				};
+			}();
+
+
+			const llvm::Reloc::Model reloc_model = [&]() noexcept {
+				switch(target_config.relocModel){
+					case RelocModel::Static:       return llvm::Reloc::Static;
+					case RelocModel::PIC:          return llvm::Reloc::PIC_;
+					case RelocModel::DynamicNoPIC: return llvm::Reloc::DynamicNoPIC;
+					case RelocModel::ROPI:         return llvm::Reloc::ROPI;
+					case RelocModel::RWPI:         return llvm::Reloc::RWPI;
+					case RelocModel::ROPI_RWPI:    return llvm::Reloc::ROPI_RWPI;
+					default: evo::debugFatalBreak("Unknown relocation model");
+				};
+			}();
+
+
+			const std::optional<llvm::CodeModel::Model> code_model = [&]() noexcept -> std::optional<llvm::CodeModel::Model> {
+				switch(target_config.codeModel){
+					case CodeModel::Default: return std::nullopt;
+					case CodeModel::Tiny:    return llvm::CodeModel::Tiny;
+					case CodeModel::Small:   return llvm::CodeModel::Small;
+					case CodeModel::Kernel:  return llvm::CodeModel::Kernel;
+					case CodeModel::Medium:  return llvm::CodeModel::Medium;
+					case CodeModel::Large:   return llvm::CodeModel::Large;
+					default: evo::debugFatalBreak("Unknown code model");
+				};
+			}();
+
+
+			auto cpu = std::string();
+			auto features = std::string();
+
+			if(target_config.cpu == "native"){
+				// the CPU of the host means nothing for a different architecture
+				const std::string host_triple = llvm::sys::getProcessTriple();
+				if(llvm::Triple(target_triple).getArch() != llvm::Triple(host_triple).getArch()){
+					return std::format(
+						"Target CPU \"native\" requires targeting the architecture of the host (host: \"{}\", target: \"{}\")",
+						host_triple, target_triple
+					);
+				}
+
+				cpu = std::string(llvm::sys::getHostCPUName());
+
+				auto host_features = llvm::StringMap<bool>();
+				if(llvm::sys::getHostCPUFeatures(host_features)){
+					for(const auto& host_feature : host_features){
+						if(features.empty() == false){ features += ','; }
+						features += host_feature.getValue() ? '+' : '-';
+						features += host_feature.getKey();
+					}
+				}
+
+			}else{
+				cpu = target_config.cpu;
+
+				// checked here since LLVM only prints a warning and then generates code for an invalid subtarget
+				const auto subtarget_info = std::unique_ptr<llvm::MCSubtargetInfo>(
+					target->createMCSubtargetInfo(target_triple, "", "")
+				);
+				if(subtarget_info->isCPUStringValid(cpu) == false){
+					return std::format("Unknown CPU \"{}\" for target \"{}\"", cpu, target_triple);
+				}
+			}
+
+			if(target_config.features.empty() == false){
+				if(features.empty() == false){ features += ','; }
+				features += target_config.features;
+			}
+
+
 			auto opt = llvm::TargetOptions();
-			this->target_machine = target->createTargetMachine(target_triple, cpu, features, opt, llvm::Reloc::PIC_);
 
+			// so that the linker can remove unused functions / globals
+			opt.FunctionSections = true;
+			opt.DataSections = true;
 
-			this->module->setDataLayout(target_machine->createDataLayout());
+			this->target_machine = std::shared_ptr<llvm::TargetMachine>(target->createTargetMachine(
+				target_triple, cpu, features, opt, reloc_model, code_model, codegen_opt_level
+			));
+
+			if(this->target_machine == nullptr){
+				return std::format("Failed to create target machine for target \"{}\" (cpu: \"{}\")", target_triple, cpu);
+			}
+
+
+			this->module->setDataLayout(this->target_machine->createDataLayout());
 
 			return error_msg;
 		};
 
 
 
+		auto Module::optimize(OptLevel opt_level) noexcept -> void {
+			evo::debugAssert(this->target_machine != nullptr, "Data layout must be set before optimizing");
+
+			// the passes assume the IR is valid, so invalid IR from lowering would otherwise show up as a crash in some pass
+			#if defined(PANTHER_CONFIG_DEBUG)
+			{
+				auto verify_errors = std::string();
+				auto verify_errors_stream = llvm::raw_string_ostream(verify_errors);
+				if(llvm::verifyModule(*this->module, &verify_errors_stream)){
+					verify_errors_stream.flush();
+					evo::debugFatalBreak(std::format("Invalid LLVM IR in module \"{}\":\n{}", this->module->getName().str(), verify_errors));
+				}
+			}
+			#endif
+
+			auto loop_analysis_manager = llvm::LoopAnalysisManager();
+			auto function_analysis_manager = llvm::FunctionAnalysisManager();
+			auto cgscc_analysis_manager = llvm::CGSCCAnalysisManager();
+			auto module_analysis_manager = llvm::ModuleAnalysisManager();
+
+
+			// a trace span for every pass that runs
+			// 	(passes that contain other passes, like pass managers, are nested)
+			auto pass_instrumentation = llvm::PassInstrumentationCallbacks();
+			auto pass_trace_spans = std::vector<std::unique_ptr<Trace::Span>>();
+
+			if(Trace::isEnabled()){
+				pass_instrumentation.registerBeforeNonSkippedPassCallback(
+					[&](llvm::StringRef pass_name, llvm::Any ir_unit) -> void {
+						pass_trace_spans.emplace_back(
+							std::make_unique<Trace::Span>(std::string_view(pass_name), [&]() noexcept -> std::string {
+								const llvm::Function* const* func = llvm::any_cast<const llvm::Function*>(&ir_unit);
+								if(func == nullptr){ return std::string(); }
+								return (*func)->getName().str();
+							})
+						);
+					}
+				);
+
+				pass_instrumentation.registerAfterPassCallback(
+					[&](llvm::StringRef, llvm::Any, const llvm::PreservedAnalyses&) -> void {
+						pass_trace_spans.pop_back();
+					}
+				);
+
+				pass_instrumentation.registerAfterPassInvalidatedCallback(
+					[&](llvm::StringRef, const llvm::PreservedAnalyses&) -> void {
+						pass_trace_spans.pop_back();
+					}
+				);
+			}
+
+			auto pass_builder = llvm::PassBuilder(
+				this->target_machine.get(), llvm::PipelineTuningOptions(), std::nullopt, &pass_instrumentation
+			);
+
+			pass_builder.registerModuleAnalyses(module_analysis_manager);
+			pass_builder.registerCGSCCAnalyses(cgscc_analysis_manager);
+			pass_builder.registerFunctionAnalyses(function_analysis_manager);
+			pass_builder.registerLoopAnalyses(loop_analysis_manager);
+			pass_builder.crossRegisterProxies(
+				loop_analysis_manager, function_analysis_manager, cgscc_analysis_manager, module_analysis_manager
+			);
+
+
+			auto module_pass_manager = [&]() noexcept -> llvm::ModulePassManager {
+				switch(opt_level){
+					case OptLevel::O0: return pass_builder.buildO0DefaultPipeline(llvm::OptimizationLevel::O0);
+					case OptLevel::O1: return pass_builder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O1);
+					case OptLevel::O2: return pass_builder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2);
+					case OptLevel::O3: return pass_builder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O3);
+					default: evo::debugFatalBreak("Unknown optimization level");
+				};
+			}();
+
+			module_pass_manager.run(*this->module, module_analysis_manager);
+		};
+
+
+
 		auto Module::compileToObjectFile() noexcept -> evo::Result<std::vector<evo::byte>> {
+			const auto trace_span = Trace::Span("Module::compileToObjectFile", [&]() noexcept -> std::string {
+				return this->module->getModuleIdentifier();
+			});
+
 			auto data = llvm::SmallVector<char>();
 			auto stream = llvm::raw_svector_ostream(data);
 
@@ -129,8 +316,204 @@ namespace panther{
 
 
 
-		auto Module::get_clone() const noexcept -> std::unique_ptr<llvm::Module> {
-			return llvm::CloneModule(*this->module);
+		auto Module::compileToObjectFiles(evo::uint num_partitions) noexcept
+		-> evo::Result<std::vector<std::vector<evo::byte>>> {
+			evo::debugAssert(num_partitions > 0, "Must have at least 1 partition");
+
+			const auto trace_span = Trace::Span("Module::compileToObjectFiles", [&]() noexcept -> std::string {
+				return std::format("{} partitions", num_partitions);
+			});
+
+			if(num_partitions == 1){
+				evo::Result<std::vector<evo::byte>> object_file = this->compileToObjectFile();
+				if(object_file.isError()){ return evo::resultError; }
+
+				auto output = std::vector<std::vector<evo::byte>>();
+				output.emplace_back(std::move(object_file.value()));
+				return output;
+			}
+
+
+			// checked here as llvm::splitCodeGen has no way of reporting it
+			{
+				auto pass = llvm::legacy::PassManager();
+				auto null_stream = llvm::raw_null_ostream();
+				if(this->target_machine->addPassesToEmitFile(pass, null_stream, nullptr, llvm::CodeGenFileType::ObjectFile)){
+					return evo::resultError;
+				}
+			}
+
+
+			auto partition_data = std::vector<llvm::SmallVector<char, 0>>(num_partitions);
+			auto partition_streams = std::vector<std::unique_ptr<llvm::raw_svector_ostream>>();
+			auto partition_stream_ptrs = std::vector<llvm::raw_pwrite_stream*>();
+			for(llvm::SmallVector<char, 0>& data : partition_data){
+				partition_stream_ptrs.emplace_back(
+					partition_streams.emplace_back(std::make_unique<llvm::raw_svector_ostream>(data)).get()
+				);
+			}
+
+			// each thread needs its own target machine
+			const llvm::TargetMachine& target_machine = *this->target_machine;
+			const auto create_target_machine = [&]() noexcept -> std::unique_ptr<llvm::TargetMachine> {
+				return std::unique_ptr<llvm::TargetMachine>(
+					target_machine.getTarget().createTargetMachine(
+						target_machine.getTargetTriple().str(),
+						target_machine.getTargetCPU(),
+						target_machine.getTargetFeatureString(),
+						target_machine.Options,
+						target_machine.getRelocationModel(),
+						target_machine.getCodeModel(),
+						target_machine.getOptLevel()
+					)
+				);
+			};
+
+			llvm::splitCodeGen(*this->module, partition_stream_ptrs, {}, create_target_machine, llvm::CodeGenFileType::ObjectFile);
+
+
+			auto output = std::vector<std::vector<evo::byte>>();
+			output.reserve(num_partitions);
+			for(const llvm::SmallVector<char, 0>& data : partition_data){
+				std::vector<evo::byte>& object_file = output.emplace_back(data.size());
+				std::memcpy(object_file.data(), data.data(), data.size());
+			}
+
+			return output;
+		};
+
+
+
+		auto Module::split(std::span<const Partition> partitions) noexcept -> std::vector<std::unique_ptr<Module>> {
+			// index of the partition that defines each global value (not in the map means the last module)
+			auto partition_indices = std::unordered_map<const llvm::GlobalValue*, size_t>();
+			for(size_t i = 0; i < partitions.size(); i+=1){
+				for(llvm::Function* func : partitions[i].funcs){
+					partition_indices.emplace(func, i);
+				}
+
+				for(llvm::GlobalVariable* global_var : partitions[i].globalVars){
+					partition_indices.emplace(global_var, i);
+				}
+			}
+
+			const auto get_partition_index = [&](const llvm::GlobalValue* global_value) noexcept -> size_t {
+				const auto find = partition_indices.find(global_value);
+				if(find == partition_indices.end()){ return partitions.size(); }
+				return find->second;
+			};
+
+			// internal constants that aren't in a partition (like string literals) are copied into every module that uses them
+			// 	(every other global value that isn't in a partition is defined only in the last module)
+			const auto is_copied_into_every_module = [&](const llvm::GlobalValue& global_value) noexcept -> bool {
+				if(global_value.hasLocalLinkage() == false || partition_indices.contains(&global_value)){ return false; }
+
+				const auto* global_var = llvm::dyn_cast<llvm::GlobalVariable>(&global_value);
+				return global_var != nullptr && global_var->isConstant();
+			};
+
+			// only the internal symbols that are needed by other partitions are changed
+			// 	so that the optimizer can still remove the rest if they aren't used
+			const auto is_used_by_other_partition = [&](const llvm::GlobalValue& global_value) noexcept -> bool {
+				const size_t partition_index = get_partition_index(&global_value);
+
+				auto pending_values = std::vector<const llvm::Value*>{&global_value};
+				while(pending_values.empty() == false){
+					const llvm::Value* value = pending_values.back();
+					pending_values.pop_back();
+
+					for(const llvm::User* user : value->users()){
+						if(const auto* instruction = llvm::dyn_cast<llvm::Instruction>(user)){
+							if(get_partition_index(instruction->getFunction()) != partition_index){ return true; }
+
+						}else if(const auto* user_global_value = llvm::dyn_cast<llvm::GlobalValue>(user)){
+							if(is_copied_into_every_module(*user_global_value)){ return true; }
+							if(get_partition_index(user_global_value) != partition_index){ return true; }
+
+						}else{
+							// constant expressions
+							pending_values.emplace_back(user);
+						}
+					}
+				}
+
+				return false;
+			};
+
+			for(llvm::GlobalValue& global_value : this->module->global_values()){
+				if(
+					global_value.hasLocalLinkage()
+					&& is_copied_into_every_module(global_value) == false
+					&& is_used_by_other_partition(global_value)
+				){
+					global_value.setLinkage(llvm::GlobalValue::ExternalLinkage);
+					global_value.setVisibility(llvm::GlobalValue::HiddenVisibility);
+				}
+			}
+
+
+			auto output = std::vector<std::unique_ptr<Module>>();
+			output.reserve(partitions.size() + 1);
+
+			for(size_t i = 0; i <= partitions.size(); i+=1){
+				auto value_map = llvm::ValueToValueMapTy();
+				std::unique_ptr<llvm::Module> partition_module = llvm::CloneModule(
+					*this->module, value_map, [&](const llvm::GlobalValue* global_value) noexcept -> bool {
+						if(is_copied_into_every_module(*global_value)){ return true; }
+
+						return get_partition_index(global_value) == i;
+					}
+				);
+
+				// removed so that a partition only changes if something it actually uses changes
+				bool removed_global_value = true;
+				while(removed_global_value){
+					removed_global_value = false;
+
+					for(llvm::GlobalValue& global_value : llvm::make_early_inc_range(partition_module->global_values())){
+						if(global_value.use_empty() == false){ continue; }
+						if(global_value.hasLocalLinkage() == false && global_value.isDeclaration() == false){ continue; }
+
+						global_value.eraseFromParent();
+						removed_global_value = true;
+					}
+				}
+
+				output.emplace_back(new Module(std::move(partition_module), this->target_machine));
+			}
+
+			delete this->module;
+			this->module = nullptr;
+
+			return output;
+		};
+
+
+		auto Module::hash() const noexcept -> std::string {
+			evo::debugAssert(this->target_machine != nullptr, "Data layout must be set before hashing");
+
+			auto data = llvm::SmallVector<char, 0>();
+			auto stream = llvm::raw_svector_ostream(data);
+			llvm::WriteBitcodeToFile(*this->module, stream);
+
+			stream << '\0' << this->target_machine->getTargetCPU();
+			stream << '\0' << this->target_machine->getTargetFeatureString();
+			stream << '\0' << int(this->target_machine->getRelocationModel());
+			stream << '\0' << int(this->target_machine->getCodeModel());
+			stream << '\0' << int(this->target_machine->getOptLevel());
+
+			// the output also depends on the compiler itself, so object files cached by a different version aren't reused
+			stream << '\0' << HASH_VERSION << '\0' << LLVM_VERSION_STRING;
+
+			auto sha256 = llvm::SHA256();
+			sha256.update(llvm::StringRef(data.data(), data.size()));
+			return llvm::toHex(sha256.final(), true);
+		};
+
+
+
+		auto Module::release() noexcept -> std::unique_ptr<llvm::Module> {
+			return std::unique_ptr<llvm::Module>(std::exchange(this->module, nullptr));
 		};
 
 	
@@ -52,6 +52,18 @@ namespace panther{
 			func->addFnAttr(llvm::Attribute::AttrKind::NoReturn);
 		};
 
+		auto setArgNoCapture(llvm::Argument* arg) noexcept -> void {
+			arg->addAttr(llvm::Attribute::AttrKind::NoCapture);
+		};
+
+		auto setArgStructRet(llvm::Argument* arg, llvm::Type* type) noexcept -> void {
+			arg->addAttr(llvm::Attribute::getWithStructRetType(arg->getContext(), type));
+		};
+
+		auto setCallArgStructRet(llvm::CallInst* call, llvm::Type* type) noexcept -> void {
+			call->addParamAttr(0, llvm::Attribute::getWithStructRetType(call->getContext(), type));
+		};
+
 	
 	};
 };
\ No newline at end of file
@@ -85,7 +85,7 @@ project "LLVM_interface"
 		LLVM.libs.Instrumentation,
 		LLVM.libs.InterfaceStub,
 		LLVM.libs.Interpreter,
-		-- LLVM.libs.ipo,
+		LLVM.libs.ipo,
 		LLVM.libs.IRPrinter,
 		LLVM.libs.IRReader,
 		LLVM.libs.JITLink,
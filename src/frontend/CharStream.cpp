@@ -1,5 +1,13 @@
 #include "./CharStream.h"
 
+// for std::countr_zero
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+	#define PANTHER_CHAR_STREAM_SSE2
+	#include <emmintrin.h>
+#endif
+
 
 namespace panther{
 
@@ -15,25 +23,14 @@ namespace panther{
 
 		const char current_char = this->peek();
 
-
-		if(current_char == '\n'){
-			this->line += 1;
-			this->collumn = 1;
-
-		}else if(current_char == '\r'){
-			this->line += 1;
-			this->collumn = 1;
-
+		// "\r\n" is treated as a single char
+		if(current_char == '\r'){
 			const bool is_at_end = this->cursor + 1 >= ptrdiff_t(this->size());
 			if(is_at_end == false && this->peek(1) == '\n'){
 				this->cursor += 1;	
 			}
-
-		}else{
-			this->collumn += 1;
 		}
 
-
 		this->cursor += 1;
 
 		return current_char;
@@ -54,5 +51,152 @@ namespace panther{
 	};
 
 
+
+	//////////////////////////////////////////////////////////////////////
+	// fast paths
+
+	enum class RunKind{
+		Whitespace,
+		NotLineEnd,
+		NotBlockCommentDelimiter,
+		Identifier,
+	};
+
+
+	template<RunKind RUN_KIND>
+	EVO_NODISCARD static constexpr auto is_run_char(char c) noexcept -> bool {
+		if constexpr(RUN_KIND == RunKind::Whitespace){
+			return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+
+		}else if constexpr(RUN_KIND == RunKind::NotLineEnd){
+			return c != '\n' && c != '\r';
+
+		}else if constexpr(RUN_KIND == RunKind::NotBlockCommentDelimiter){
+			return c != '/' && c != '*';
+
+		}else{
+			return evo::isAlphaNumeric(c) || c == '_';
+		}
+	};
+
+
+	#if defined(PANTHER_CHAR_STREAM_SSE2)
+
+		// returns a mask with a bit set for each of the 16 chars that is not part of the run
+		// 	(for RunKind::Identifier only ASCII letters / numbers / '_' are considered part of the run,
+		// 	anything else is left to the scalar loop in `count_run()`)
+		template<RunKind RUN_KIND>
+		EVO_NODISCARD static auto get_stop_mask(__m128i chars) noexcept -> int {
+			const auto matches = [&](char c) noexcept -> __m128i {
+				return _mm_cmpeq_epi8(chars, _mm_set1_epi8(c));
+			};
+
+			if constexpr(RUN_KIND == RunKind::Whitespace){
+				return ~_mm_movemask_epi8(
+					_mm_or_si128(_mm_or_si128(matches(' '), matches('\t')), _mm_or_si128(matches('\n'), matches('\r')))
+				) & 0xFFFF;
+
+			}else if constexpr(RUN_KIND == RunKind::NotLineEnd){
+				return _mm_movemask_epi8(_mm_or_si128(matches('\n'), matches('\r')));
+
+			}else if constexpr(RUN_KIND == RunKind::NotBlockCommentDelimiter){
+				return _mm_movemask_epi8(_mm_or_si128(matches('/'), matches('*')));
+
+			}else{
+				// signed compares are fine as none of the ranges include chars >= 0x80
+				const auto in_range = [&](__m128i vec, char min, char max) noexcept -> __m128i {
+					return _mm_and_si128(
+						_mm_cmpgt_epi8(vec, _mm_set1_epi8(char(min - 1))), _mm_cmplt_epi8(vec, _mm_set1_epi8(char(max + 1)))
+					);
+				};
+
+				const __m128i lower_case = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+
+				const __m128i is_ident_char = _mm_or_si128(
+					_mm_or_si128(in_range(lower_case, 'a', 'z'), in_range(chars, '0', '9')), matches('_')
+				);
+
+				return ~_mm_movemask_epi8(is_ident_char) & 0xFFFF;
+			}
+		};
+
+	#endif
+
+
+	// number of chars at the beginning of `str` that are part of the run
+	template<RunKind RUN_KIND>
+	EVO_NODISCARD static auto count_run(std::string_view str) noexcept -> size_t {
+		size_t count = 0;
+
+		#if defined(PANTHER_CHAR_STREAM_SSE2)
+			while(str.size() - count >= 16){
+				const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + count));
+
+				const int stop_mask = get_stop_mask<RUN_KIND>(chars);
+				if(stop_mask != 0){
+					count += size_t(std::countr_zero(unsigned(stop_mask)));
+					break;
+				}
+
+				count += 16;
+			};
+		#endif
+
+		while(count < str.size() && is_run_char<RUN_KIND>(str[count])){
+			count += 1;
+		};
+
+		return count;
+	};
+
+
+
+	auto CharStream::skip_whitespace() noexcept -> void {
+		this->skip_run(count_run<RunKind::Whitespace>(this->data.substr(size_t(this->cursor))));
+	};
+
+	auto CharStream::skip_to_line_end() noexcept -> void {
+		this->skip_run(count_run<RunKind::NotLineEnd>(this->data.substr(size_t(this->cursor))));
+	};
+
+	auto CharStream::skip_to_block_comment_delimiter() noexcept -> void {
+		this->skip_run(count_run<RunKind::NotBlockCommentDelimiter>(this->data.substr(size_t(this->cursor))));
+	};
+
+	auto CharStream::skip_identifier_chars() noexcept -> size_t {
+		const size_t ammount = count_run<RunKind::Identifier>(this->data.substr(size_t(this->cursor)));
+		this->skip_run(ammount);
+		return ammount;
+	};
+
+
+	auto CharStream::skip_run(size_t ammount) noexcept -> void {
+		evo::debugAssert(this->cursor + ptrdiff_t(ammount) <= ptrdiff_t(this->size()), "Skip is out of bounds of the data string");
+
+		this->cursor += ptrdiff_t(ammount);
+	};
+
+
+
+	auto CharStream::get_line_starts(std::string_view source_data) noexcept -> std::vector<uint32_t> {
+		auto line_starts = std::vector<uint32_t>{0};
+
+		size_t cursor = 0;
+		while(true){
+			cursor += count_run<RunKind::NotLineEnd>(source_data.substr(cursor));
+			if(cursor >= source_data.size()){ break; }
+
+			if(source_data[cursor] == '\r' && cursor + 1 < source_data.size() && source_data[cursor + 1] == '\n'){
+				cursor += 1;
+			}
+
+			cursor += 1;
+			line_starts.emplace_back(uint32_t(cursor));
+		};
+
+		return line_starts;
+	};
+
+
 	
 };
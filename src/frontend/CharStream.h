@@ -16,6 +16,12 @@ namespace panther{
 			EVO_NODISCARD auto next() noexcept -> char;
 			auto skip(size_t ammount) noexcept -> void;
 
+			// Fast paths for skipping runs of chars (vectorized where available)
+			auto skip_whitespace() noexcept -> void; // only ' ', '\t', '\n', and '\r'
+			auto skip_to_line_end() noexcept -> void; // stops at '\n', '\r', or eof
+			auto skip_to_block_comment_delimiter() noexcept -> void; // stops at '/', '*', or eof
+			EVO_NODISCARD auto skip_identifier_chars() noexcept -> size_t; // returns number of chars skipped
+
 			
 			EVO_NODISCARD inline auto eof() const noexcept -> bool { return this->cursor >= ptrdiff_t(this->size()); }; 
 
@@ -23,17 +29,21 @@ namespace panther{
 			EVO_NODISCARD inline auto ammount_left() const noexcept -> size_t { return this->size() - size_t(this->cursor); };
 
 			EVO_NODISCARD inline auto get_raw_ptr() const noexcept -> const char* { return &this->data[this->cursor]; };
-			EVO_NODISCARD inline auto get_line() const noexcept -> uint32_t { return this->line; };
-			EVO_NODISCARD inline auto get_collumn() const noexcept -> uint32_t { return this->collumn; };
+			EVO_NODISCARD inline auto get_offset() const noexcept -> uint32_t { return uint32_t(this->cursor); };
+
+
+			// offset of the beginning of each line (newlines are treated the same as in next())
+			EVO_NODISCARD static auto get_line_starts(std::string_view source_data) noexcept -> std::vector<uint32_t>;
 
+
+		private:
+			auto skip_run(size_t ammount) noexcept -> void;
 	
 		private:
 			std::string_view data;
 			size_t data_size;
 
 			ptrdiff_t cursor = 0;
-			uint32_t line = 1;
-			uint32_t collumn = 1;
 	};
 
 
@@ -0,0 +1,177 @@
+#include "frontend/MappedFile.h"
+
+#include <utility>
+
+
+#if defined(EVO_PLATFORM_WINDOWS)
+	#if !defined(WIN32_LEAN_AND_MEAN)
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#if !defined(NOCOMM)
+		#define NOCOMM
+	#endif
+
+	#if !defined(NOMINMAX)
+		#define NOMINMAX
+	#endif
+
+	#include <Windows.h>
+
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+
+namespace panther{
+
+	MappedFile::MappedFile(MappedFile&& rhs) noexcept
+		: data(std::exchange(rhs.data, nullptr)), data_size(std::exchange(rhs.data_size, 0)), is_open(std::exchange(rhs.is_open, false))
+	{
+		#if defined(EVO_PLATFORM_WINDOWS)
+			this->mapping_handle = std::exchange(rhs.mapping_handle, nullptr);
+		#endif
+	};
+
+	auto MappedFile::operator=(MappedFile&& rhs) noexcept -> MappedFile& {
+		this->close();
+
+		this->data = std::exchange(rhs.data, nullptr);
+		this->data_size = std::exchange(rhs.data_size, 0);
+		this->is_open = std::exchange(rhs.is_open, false);
+
+		#if defined(EVO_PLATFORM_WINDOWS)
+			this->mapping_handle = std::exchange(rhs.mapping_handle, nullptr);
+		#endif
+
+		return *this;
+	};
+
+
+
+	#if defined(EVO_PLATFORM_WINDOWS)
+
+		auto MappedFile::open(const std::filesystem::path& path) noexcept -> bool {
+			evo::debugAssert(this->isOpen() == false, "MappedFile is already open");
+
+			const HANDLE file_handle = ::CreateFileW(
+				path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+			);
+			if(file_handle == INVALID_HANDLE_VALUE){ return false; }
+
+			LARGE_INTEGER file_size;
+			if(::GetFileSizeEx(file_handle, &file_size) == false){
+				::CloseHandle(file_handle);
+				return false;
+			}
+
+			this->data_size = size_t(file_size.QuadPart);
+
+			// empty files can't be mapped
+			if(this->data_size == 0){
+				::CloseHandle(file_handle);
+				this->is_open = true;
+				return true;
+			}
+
+			this->mapping_handle = ::CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			::CloseHandle(file_handle); // the mapping keeps the file open
+			if(this->mapping_handle == nullptr){
+				this->data_size = 0;
+				return false;
+			}
+
+			this->data = static_cast<const char*>(::MapViewOfFile(this->mapping_handle, FILE_MAP_READ, 0, 0, 0));
+			if(this->data == nullptr){
+				::CloseHandle(this->mapping_handle);
+				this->mapping_handle = nullptr;
+				this->data_size = 0;
+				return false;
+			}
+
+			// the whole file is read when tokenizing, so start reading it in the background now
+			// 	(this lets the reads of later files overlap with the tokenizing of earlier files)
+			auto prefetch_range = WIN32_MEMORY_RANGE_ENTRY{
+				.VirtualAddress = const_cast<char*>(this->data),
+				.NumberOfBytes  = this->data_size,
+			};
+			::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &prefetch_range, 0);
+
+			this->is_open = true;
+			return true;
+		};
+
+
+		auto MappedFile::close() noexcept -> void {
+			if(this->isOpen() == false){ return; }
+
+			if(this->data != nullptr){
+				::UnmapViewOfFile(this->data);
+				::CloseHandle(this->mapping_handle);
+			}
+
+			this->data = nullptr;
+			this->data_size = 0;
+			this->mapping_handle = nullptr;
+			this->is_open = false;
+		};
+
+	#else
+
+		auto MappedFile::open(const std::filesystem::path& path) noexcept -> bool {
+			evo::debugAssert(this->isOpen() == false, "MappedFile is already open");
+
+			const int file_descriptor = ::open(path.c_str(), O_RDONLY);
+			if(file_descriptor == -1){ return false; }
+
+			struct stat file_stat;
+			if(::fstat(file_descriptor, &file_stat) == -1){
+				::close(file_descriptor);
+				return false;
+			}
+
+			this->data_size = size_t(file_stat.st_size);
+
+			// empty files can't be mapped
+			if(this->data_size == 0){
+				::close(file_descriptor);
+				this->is_open = true;
+				return true;
+			}
+
+			void* mapping = ::mmap(nullptr, this->data_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+			::close(file_descriptor); // the mapping keeps the file open
+			if(mapping == MAP_FAILED){
+				this->data_size = 0;
+				return false;
+			}
+
+			// the whole file is read when tokenizing, so start reading it in the background now
+			// 	(this lets the reads of later files overlap with the tokenizing of earlier files)
+			::madvise(mapping, this->data_size, MADV_SEQUENTIAL);
+			::madvise(mapping, this->data_size, MADV_WILLNEED);
+
+			this->data = static_cast<const char*>(mapping);
+			this->is_open = true;
+			return true;
+		};
+
+
+		auto MappedFile::close() noexcept -> void {
+			if(this->isOpen() == false){ return; }
+
+			if(this->data != nullptr){
+				::munmap(const_cast<char*>(this->data), this->data_size);
+			}
+
+			this->data = nullptr;
+			this->data_size = 0;
+			this->is_open = false;
+		};
+
+	#endif
+
+};
@@ -130,3 +130,94 @@ namespace panther{
 
 	};
 };
+
+
+
+//////////////////////////////////////////////////////////////////////
+// hashing
+
+EVO_NODISCARD static constexpr auto hash_combine(size_t seed, size_t value) noexcept -> size_t {
+	return seed ^ (value + size_t(0x9e3779b9) + (seed << 6) + (seed >> 2));
+};
+
+
+EVO_NODISCARD static auto hash_expr(const panther::PIR::Expr& expr) noexcept -> size_t {
+	using Kind = panther::PIR::Expr::Kind;
+
+	const size_t kind_hash = std::hash<Kind>{}(expr.kind);
+
+	switch(expr.kind){
+		case Kind::Import:        return hash_combine(kind_hash, std::hash<uint32_t>{}(expr.import.id));
+
+		case Kind::LiteralBool:   return hash_combine(kind_hash, std::hash<bool>{}(expr.boolean));
+		case Kind::LiteralInt:    return hash_combine(kind_hash, std::hash<uint64_t>{}(expr.integer));
+		case Kind::LiteralFloat:  return hash_combine(kind_hash, std::hash<float64_t>{}(expr.floatingPoint));
+		case Kind::LiteralChar:   return hash_combine(kind_hash, std::hash<std::string_view>{}(expr.string));
+		case Kind::LiteralString: return hash_combine(kind_hash, std::hash<std::string_view>{}(expr.string));
+
+		// other kinds are not comparable (see Expr::operator==)
+		default: return kind_hash;
+	};
+};
+
+
+EVO_NODISCARD static auto hash_type_voidable_id(panther::PIR::TypeVoidableID id) noexcept -> size_t {
+	if(id.isVoid()){ return std::numeric_limits<size_t>::max(); }
+	return std::hash<panther::PIR::TypeID>{}(id.typeID());
+};
+
+
+
+auto std::hash<panther::PIR::BaseType>::operator()(const panther::PIR::BaseType& base_type) const noexcept -> size_t {
+	using BaseType = panther::PIR::BaseType;
+
+	size_t hash = std::hash<BaseType::Kind>{}(base_type.kind);
+
+	switch(base_type.kind){
+		case BaseType::Kind::Builtin: {
+			hash = hash_combine(hash, std::hash<panther::Token::Kind>{}(std::get<BaseType::BuiltinData>(base_type.data).kind));
+		} break;
+
+		case BaseType::Kind::Function: {
+			if(base_type.callOperator.has_value() == false){ break; }
+
+			for(const BaseType::Operator::Param& param : base_type.callOperator->params){
+				hash = hash_combine(hash, std::hash<panther::PIR::TypeID>{}(param.type));
+				hash = hash_combine(hash, std::hash<panther::AST::FuncParams::Param::Kind>{}(param.kind));
+			}
+			hash = hash_combine(hash, hash_type_voidable_id(base_type.callOperator->returnType));
+		} break;
+
+		case BaseType::Kind::Struct: {
+			const BaseType::StructData& struct_data = std::get<BaseType::StructData>(base_type.data);
+
+			hash = hash_combine(hash, std::hash<std::string_view>{}(struct_data.name));
+			hash = hash_combine(hash, std::hash<const panther::Source*>{}(struct_data.source));
+
+			for(const panther::PIR::TemplateArg& template_arg : struct_data.templateArgs){
+				hash = hash_combine(hash, std::hash<bool>{}(template_arg.isType));
+				hash = hash_combine(hash, hash_type_voidable_id(template_arg.typeID));
+
+				if(template_arg.expr.has_value()){
+					hash = hash_combine(hash, hash_expr(*template_arg.expr));
+				}
+			}
+		} break;
+
+		default: break;
+	};
+
+	return hash;
+};
+
+
+auto std::hash<panther::PIR::Type>::operator()(const panther::PIR::Type& type) const noexcept -> size_t {
+	size_t hash = std::hash<uint32_t>{}(type.baseType.id);
+
+	for(const panther::AST::Type::Qualifier& qualifier : type.qualifiers){
+		hash = hash_combine(hash, size_t(qualifier.isPtr) | (size_t(qualifier.isConst) << 1));
+	}
+
+	return hash;
+};
+
@@ -96,15 +96,15 @@ namespace panther{
 		if(this->check_result_fail(ident, "identifier in variable declaration")){ return Result::Error; }
 
 		// attributes
-		auto attributes = std::vector<Token::ID>();
-		while(this->get(this->peek()).kind == Token::Attribute){
+		auto attributes = this->start_list(this->token_id_stack);
+		while(this->get_kind(this->peek()) == Token::Attribute){
 			attributes.emplace_back(this->next());
 		};
 
 
 		// type
 		auto type = std::optional<AST::Node::ID>();
-		if(this->get(this->peek()).kind == Token::get(":")){
+		if(this->get_kind(this->peek()) == Token::get(":")){
 			this->skip(1);
 
 			const Result type_result = this->parse_type();
@@ -114,12 +114,12 @@ namespace panther{
 		}
 
 		// no value given
-		if(this->get(this->peek()).kind == Token::get(";")){
+		if(this->get_kind(this->peek()) == Token::get(";")){
 			this->skip(1);
 			
 			return this->create_node(
 				this->source.var_decls, AST::Kind::VarDecl,
-				is_def, ident.value(), std::move(attributes), type, std::nullopt
+				is_def, ident.value(), attributes.finish(), type, std::nullopt
 			);			
 		}
 
@@ -137,14 +137,14 @@ namespace panther{
 
 		return this->create_node(
 			this->source.var_decls, AST::Kind::VarDecl,
-			is_def, ident.value(), std::move(attributes), type, expr.value()
+			is_def, ident.value(), attributes.finish(), type, expr.value()
 		);
 	};
 
 
 	// TODO: add checking for EOF
 	auto Parser::parse_func() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::KeywordFunc){
+		if(this->get_kind(this->peek()) != Token::KeywordFunc){
 			return Result::WrongType;
 		}
 
@@ -176,8 +176,8 @@ namespace panther{
 
 
 		// attributes
-		auto attributes = std::vector<Token::ID>();
-		while(this->get(this->peek()).kind == Token::Attribute){
+		auto attributes = this->start_list(this->token_id_stack);
+		while(this->get_kind(this->peek()) == Token::Attribute){
 			attributes.emplace_back(this->next());
 		};
 
@@ -196,14 +196,14 @@ namespace panther{
 
 		return this->create_node(
 			this->source.funcs, AST::Kind::Func,
-			ident.value(), template_pack_value, func_params.value(), std::move(attributes), return_type.value(), block.value()
+			ident.value(), template_pack_value, func_params.value(), attributes.finish(), return_type.value(), block.value()
 		);
 	};
 
 
 	// TODO: add checking for EOF
 	auto Parser::parse_struct() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::KeywordStruct){ return Result::WrongType; }
+		if(this->get_kind(this->peek()) != Token::KeywordStruct){ return Result::WrongType; }
 		this->skip(1);
 
 		// ident
@@ -226,8 +226,8 @@ namespace panther{
 		}();
 
 		// attributes
-		auto attributes = std::vector<Token::ID>();
-		while(this->get(this->peek()).kind == Token::Attribute){
+		auto attributes = this->start_list(this->token_id_stack);
+		while(this->get_kind(this->peek()) == Token::Attribute){
 			attributes.emplace_back(this->next());
 		};
 
@@ -236,7 +236,7 @@ namespace panther{
 
 		return this->create_node(
 			this->source.structs, AST::Kind::Struct,
-			ident.value(), template_pack_value, std::move(attributes), block.value()
+			ident.value(), template_pack_value, attributes.finish(), block.value()
 		);
 	};
 
@@ -244,14 +244,14 @@ namespace panther{
 	// TODO: add checking for EOF
 	auto Parser::parse_template_pack() noexcept -> Result {
 		// |
-		if(this->get(this->peek()).kind != Token::get("<{")){ return Result::WrongType; }
+		if(this->get_kind(this->peek()) != Token::get("<{")){ return Result::WrongType; }
 		const Token::ID start_location = this->next();
 
 
-		auto templates = std::vector<AST::TemplatePack::Template>();
+		auto templates = this->start_list(this->template_stack);
 
 		while(true){
-			if(this->get(this->peek()).kind == Token::get("}>")){
+			if(this->get_kind(this->peek()) == Token::get("}>")){
 				this->skip(1);
 				break;
 			}
@@ -265,7 +265,7 @@ namespace panther{
 
 
 			// type
-			if(this->get(this->peek()).kind == Token::KeywordType){
+			if(this->get_kind(this->peek()) == Token::KeywordType){
 				templates.emplace_back(ident_result.value(), this->next());
 
 			}else{
@@ -295,7 +295,7 @@ namespace panther{
 
 		return this->create_node(
 			this->source.template_packs, AST::Kind::TemplatePack,
-			start_location, std::move(templates)
+			start_location, templates.finish()
 		);
 	};
 
@@ -303,14 +303,14 @@ namespace panther{
 	// TODO: add checking for EOF
 	auto Parser::parse_func_params() noexcept -> Result {
 		// (
-		if(this->get(this->peek()).kind != Token::get("(")){ return Result::WrongType; }
+		if(this->get_kind(this->peek()) != Token::get("(")){ return Result::WrongType; }
 		const Token::ID start_location = this->next();
 
 
-		auto params = std::vector<AST::FuncParams::Param>();
+		auto params = this->start_list(this->param_stack);
 
 		while(true){
-			if(this->get(this->peek()).kind == Token::get(")")){
+			if(this->get_kind(this->peek()) == Token::get(")")){
 				this->skip(1);
 				break;
 			}
@@ -329,7 +329,7 @@ namespace panther{
 			// kind
 			using ParamKind = AST::FuncParams::Param::Kind;
 			const ParamKind param_kind = [&]() noexcept {
-				switch(this->get(this->peek()).kind){
+				switch(this->get_kind(this->peek())){
 					case Token::KeywordRead: {
 						this->skip(1);
 						return ParamKind::Read;
@@ -375,7 +375,7 @@ namespace panther{
 
 		return this->create_node(
 			this->source.func_params, AST::Kind::FuncParams,
-			start_location, std::move(params)
+			start_location, params.finish()
 		);
 	};
 
@@ -383,7 +383,7 @@ namespace panther{
 
 	// TODO: add checking for EOF
 	auto Parser::parse_conditional() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::KeywordIf){
+		if(this->get_kind(this->peek()) != Token::KeywordIf){
 			return Result::WrongType;
 		}
 
@@ -405,11 +405,11 @@ namespace panther{
 
 
 		auto else_stmt = std::optional<AST::Node::ID>();
-		if(this->get(this->peek()).kind == Token::KeywordElse){
+		if(this->get_kind(this->peek()) == Token::KeywordElse){
 			this->skip(1);
 
 			const Result else_stmt_result = [&]() noexcept {
-				if(this->get(this->peek()).kind == Token::KeywordIf){
+				if(this->get_kind(this->peek()) == Token::KeywordIf){
 					return this->parse_conditional();
 				}else{
 					return this->parse_block();
@@ -435,7 +435,7 @@ namespace panther{
 
 	// TODO: add checking for EOF
 	auto Parser::parse_return() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::KeywordReturn){
+		if(this->get_kind(this->peek()) != Token::KeywordReturn){
 			return Result::WrongType;
 		}
 
@@ -444,7 +444,7 @@ namespace panther{
 		std::optional<AST::Node::ID> value = std::nullopt;
 
 
-		if(this->get(this->peek()).kind == Token::get(";")){
+		if(this->get_kind(this->peek()) == Token::get(";")){
 			this->skip(1);
 		}else{
 			const Result value_result = this->parse_expr();
@@ -483,7 +483,7 @@ namespace panther{
 		// op
 		const Token::ID op = this->next();
 
-		switch(this->get(op).kind){
+		switch(this->get_kind(op)){
 			case Token::get("="): break;
 
 			default:
@@ -509,7 +509,7 @@ namespace panther{
 
 
 	auto Parser::parse_unreachable() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::KeywordUnreachable){ return Result::WrongType; }
+		if(this->get_kind(this->peek()) != Token::KeywordUnreachable){ return Result::WrongType; }
 
 		const Token::ID tok = this->next();
 
@@ -521,7 +521,7 @@ namespace panther{
 
 
 	auto Parser::parse_alias() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::KeywordAlias){ return Result::WrongType; };
+		if(this->get_kind(this->peek()) != Token::KeywordAlias){ return Result::WrongType; };
 		this->skip(1);
 
 		// ident
@@ -529,8 +529,8 @@ namespace panther{
 		if(this->check_result_fail(ident, "identifier in alias")){ return Result::Error; }
 
 		// attributes
-		auto attributes = std::vector<Token::ID>();
-		while(this->get(this->peek()).kind == Token::Attribute){
+		auto attributes = this->start_list(this->token_id_stack);
+		while(this->get_kind(this->peek()) == Token::Attribute){
 			attributes.emplace_back(this->next());
 		};
 
@@ -545,7 +545,7 @@ namespace panther{
 
 		return this->create_node(
 			this->source.aliases, AST::Kind::Alias,
-			ident.value(), std::move(attributes), type.value()
+			ident.value(), attributes.finish(), type.value()
 		);
 	};
 
@@ -556,7 +556,7 @@ namespace panther{
 	// TODO: add checking for EOF
 	auto Parser::parse_type() noexcept -> Result {
 		bool is_builtin = true;
-		switch(this->get(this->peek()).kind){
+		switch(this->get_kind(this->peek())){
 			case Token::TypeVoid:
 			case Token::TypeInt:
 			case Token::TypeUInt:
@@ -591,12 +591,12 @@ namespace panther{
 
 
 
-		auto qualifiers = std::vector<AST::Type::Qualifier>();
-		while(this->get(this->peek()).kind == Token::get("&")){
+		auto qualifiers = this->start_list(this->qualifier_stack);
+		while(this->get_kind(this->peek()) == Token::get("&")){
 			this->skip(1);
 
 			bool is_const = false;
-			if(this->get(this->peek()).kind == Token::get("|")){
+			if(this->get_kind(this->peek()) == Token::get("|")){
 				is_const = true;
 				this->skip(1);
 			}
@@ -607,25 +607,25 @@ namespace panther{
 
 		return this->create_node(
 			this->source.types, AST::Kind::Type,
-			is_builtin, base_type.value(), std::move(qualifiers)
+			is_builtin, base_type.value(), qualifiers.finish()
 		);
 	};
 
 
 	// TODO: add checking for EOF
 	auto Parser::parse_block() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::get("{")){
+		if(this->get_kind(this->peek()) != Token::get("{")){
 			return Result::WrongType;
 		}
 
 		this->skip(1);
 
-		auto statements = std::vector<AST::Node::ID>();
+		auto statements = this->start_list(this->node_id_stack);
 
 
 
 		while(true){
-			if(this->get(this->peek()).kind == Token::get("}")){
+			if(this->get_kind(this->peek()) == Token::get("}")){
 				this->skip(1);
 				break;
 			}
@@ -633,14 +633,14 @@ namespace panther{
 			const Result stmt = this->parse_stmt();
 			if(this->check_result_fail(stmt, "statement in statement block")){ return Result::Error; }
 
-			statements.push_back(stmt.value());
+			statements.emplace_back(stmt.value());
 		};
 
 
 
 		return this->create_node(
 			this->source.blocks, AST::Kind::Block,
-			std::move(statements)
+			statements.finish()
 		);
 	};
 
@@ -648,7 +648,7 @@ namespace panther{
 
 
 	auto Parser::parse_uninit() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::KeywordUninit){
+		if(this->get_kind(this->peek()) != Token::KeywordUninit){
 			return Result::WrongType;
 		}
 
@@ -704,7 +704,7 @@ namespace panther{
 
 	auto Parser::parse_infix_expr_impl(AST::Node::ID lhs, int prec_level) noexcept -> Result {
 		const Token::ID peeked_op = this->peek();
-		const Token::Kind peeked_kind = this->get(peeked_op).kind;
+		const Token::Kind peeked_kind = this->get_kind(peeked_op);
 
 		const int next_op_prec = get_infix_op_precedence(peeked_kind);
 
@@ -745,7 +745,7 @@ namespace panther{
 	auto Parser::parse_prefix_expr() noexcept -> Result {
 		// get prefix operation
 		const Token::ID op_token = this->peek();
-		switch(this->get(op_token).kind){
+		switch(this->get_kind(op_token)){
 			case Token::KeywordCopy:
 			case Token::KeywordAddr:
 			case Token::get("-"):
@@ -764,7 +764,7 @@ namespace panther{
 			return Result::Error;
 
 		}else if(rhs.code() == Result::WrongType){
-			this->expected_but_got(std::format("valid expression on right-hand size of [{}] operator", Token::printKind(this->get(op_token).kind)));
+			this->expected_but_got(std::format("valid expression on right-hand size of [{}] operator", Token::printKind(this->get_kind(op_token))));
 			return Result::Error;
 		}
 
@@ -790,7 +790,7 @@ namespace panther{
 
 
 		while(true){
-			const Token::Kind peeked_kind = this->get(this->peek()).kind;
+			const Token::Kind peeked_kind = this->get_kind(this->peek());
 
 
 
@@ -818,10 +818,10 @@ namespace panther{
 			}else if(peeked_kind == Token::get("(") && !is_type_term){
 				this->skip(1);
 
-				auto arguments = std::vector<AST::Node::ID>();
+				auto arguments = this->start_list(this->node_id_stack);
 
 				while(true){
-					if(this->get(this->peek()).kind == Token::get(")")){
+					if(this->get_kind(this->peek()) == Token::get(")")){
 						this->skip(1);
 						break;
 					}
@@ -846,15 +846,15 @@ namespace panther{
 				};
 
 				output = this->create_node(this->source.func_calls, AST::Kind::FuncCall,
-					output.value(), std::move(arguments)
+					output.value(), arguments.finish()
 				);
 
 			}else if(peeked_kind == Token::get("<{")){
 				this->skip(1);
 
-				auto template_args = std::vector<AST::Node::ID>();
+				auto template_args = this->start_list(this->node_id_stack);
 				while(true){
-					if(this->get(this->peek()).kind == Token::get("}>")){
+					if(this->get_kind(this->peek()) == Token::get("}>")){
 						this->skip(1);
 						break;
 					}
@@ -893,7 +893,7 @@ namespace panther{
 
 
 				output = this->create_node(this->source.templated_exprs, AST::Kind::TemplatedExpr,
-					output.value(), std::move(template_args)
+					output.value(), template_args.finish()
 				);
 
 				continue;
@@ -901,9 +901,9 @@ namespace panther{
 			}else if(peeked_kind == Token::get("{") && !is_type_term){
 				this->skip(1);
 
-				auto members = std::vector<AST::Initializer::Member>();
+				auto members = this->start_list(this->member_stack);
 				while(true){
-					if(this->get(this->peek()).kind == Token::get("}")){
+					if(this->get_kind(this->peek()) == Token::get("}")){
 						this->skip(1);
 						break;
 					}
@@ -933,7 +933,7 @@ namespace panther{
 
 
 				output = this->create_node(this->source.initializers, AST::Kind::Initializer,
-					output.value(), std::move(members)
+					output.value(), members.finish()
 				);
 
 			}else{
@@ -947,7 +947,7 @@ namespace panther{
 
 	// TODO: add checking for EOF
 	auto Parser::parse_paren_expr() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::get("(")){
+		if(this->get_kind(this->peek()) != Token::get("(")){
 			return this->parse_atom();
 		}
 
@@ -957,11 +957,11 @@ namespace panther{
 		if(expr_result.code() == Result::WrongType || expr_result.code() == Result::Error){ return expr_result; }
 
 
-		if(this->get(this->peek()).kind != Token::get(")")){
+		if(this->get_kind(this->peek()) != Token::get(")")){
 			const Token& open_location_token = this->source.getToken(open_location);
 
 			this->expected_but_got("either closing parenthesis around expression or continuation of expression", 
-				std::vector<Message::Info>{ {"parenthesis opened here", open_location_token.location}, }
+				std::vector<Message::Info>{ {"parenthesis opened here", this->source.getTokenLocation(open_location_token)}, }
 			);
 			return Result::Error;
 		}
@@ -993,7 +993,7 @@ namespace panther{
 
 
 	auto Parser::parse_literal() noexcept -> Result {
-		switch(this->get(this->peek()).kind){
+		switch(this->get_kind(this->peek())){
 			case Token::LiteralBool:
 			case Token::LiteralInt:
 			case Token::LiteralFloat:
@@ -1010,7 +1010,7 @@ namespace panther{
 
 
 	auto Parser::parse_ident() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::Ident){
+		if(this->get_kind(this->peek()) != Token::Ident){
 			return Result::WrongType;
 		}
 
@@ -1018,7 +1018,7 @@ namespace panther{
 	};
 
 	auto Parser::parse_intrinsic() noexcept -> Result {
-		if(this->get(this->peek()).kind != Token::Intrinsic){
+		if(this->get_kind(this->peek()) != Token::Intrinsic){
 			return Result::WrongType;
 		}
 
@@ -1034,7 +1034,7 @@ namespace panther{
 	// messaging
 
 	auto Parser::expect_token(Token::Kind kind, evo::CStrProxy location) noexcept -> bool {
-		if(this->get(this->next()).kind != kind){
+		if(this->get_kind(this->next()) != kind){
 			this->expected_but_got(std::format("\"{}\" {}", Token::printKind(kind), location), this->peek(-1));
 			return false;
 		}
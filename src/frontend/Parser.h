@@ -116,6 +116,52 @@ namespace panther{
 
 
 
+			///////////////////////////////////
+			// child lists
+
+			// Child lists are built on a stack shared by all lists of the same type and then copied into the arena
+			// 	of the source. This works because a list nested inside of another is always finished (or abandoned)
+			// 	before the outer list gets any more elements.
+			template<class T>
+			class ChildList{
+				public:
+					ChildList(std::vector<T>& list_stack, Arena& _arena) noexcept
+						: stack(list_stack), arena(_arena), start(list_stack.size()) {};
+
+					~ChildList() noexcept {
+						this->stack.erase(this->stack.begin() + this->start, this->stack.end());
+					};
+
+					ChildList(const ChildList&) = delete;
+					auto operator=(const ChildList&) = delete;
+
+
+					auto emplace_back(auto&&... args) noexcept -> void {
+						this->stack.emplace_back(std::forward<decltype(args)>(args)...);
+					};
+
+					EVO_NODISCARD auto finish() noexcept -> std::span<const T> {
+						const std::span<const T> list = this->arena.copy(
+							std::span<const T>(this->stack.data() + this->start, this->stack.size() - this->start)
+						);
+
+						this->stack.erase(this->stack.begin() + this->start, this->stack.end());
+						return list;
+					};
+
+				private:
+					std::vector<T>& stack;
+					Arena& arena;
+					size_t start;
+			};
+
+			template<class T>
+			EVO_NODISCARD auto inline start_list(std::vector<T>& list_stack) noexcept -> ChildList<T> {
+				return ChildList<T>(list_stack, this->source.ast_arena);
+			};
+
+
+
 			///////////////////////////////////
 			// messaging
 
@@ -152,8 +198,12 @@ namespace panther{
 				return output;
 			};
 
-			EVO_NODISCARD inline auto get(Token::ID id) const noexcept -> const Token& {
-				return this->source.tokens[id.id];
+			EVO_NODISCARD inline auto get(Token::ID id) const noexcept -> Token {
+				return this->source.getToken(id);
+			};
+
+			EVO_NODISCARD inline auto get_kind(Token::ID id) const noexcept -> Token::Kind {
+				return this->source.getTokenKind(id);
 			};
 
 			EVO_NODISCARD inline auto skip(uint32_t skip_ammount) noexcept -> void {
@@ -173,6 +223,13 @@ namespace panther{
 			Source& source;
 
 			ptrdiff_t cursor = 0;
+
+			std::vector<Token::ID> token_id_stack{};
+			std::vector<AST::Node::ID> node_id_stack{};
+			std::vector<AST::TemplatePack::Template> template_stack{};
+			std::vector<AST::FuncParams::Param> param_stack{};
+			std::vector<AST::Type::Qualifier> qualifier_stack{};
+			std::vector<AST::Initializer::Member> member_stack{};
 	};
 
 
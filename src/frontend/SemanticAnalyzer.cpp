@@ -1,6 +1,7 @@
 #include "SemanticAnalyzer.h"
 
 #include "frontend/SourceManager.h"
+#include "Trace.h"
 
 #include <queue>
 #include <unordered_set>
@@ -691,7 +692,7 @@ namespace panther{
 				if(existing_func.baseType == base_type_id){
 					this->source.error(
 						"Function with same prototype already defined", ident,
-						std::vector<Message::Info>{ Message::Info("First defined here:", this->source.getToken(existing_func.ident).location) }
+						std::vector<Message::Info>{ Message::Info("First defined here:", this->source.getTokenLocation(existing_func.ident)) }
 					);
 					return false;
 				}
@@ -753,6 +754,10 @@ namespace panther{
 
 
 	auto SemanticAnalyzer::analyze_func_block(PIR::Func::ID pir_func_id, const AST::Func& ast_func, ScopeManager& scope_manager) noexcept -> bool {
+		const auto trace_span = Trace::Span("SemanticAnalyzer::analyze_func_block", [&]() noexcept -> std::string {
+			return std::string(this->source.getToken(this->source.getFunc(pir_func_id).ident).value.string);
+		});
+
 		scope_manager.enter_type_scope(ScopeManager::TypeScope::Kind::Func, pir_func_id);
 
 			PIR::Func& pir_func = this->source.getFunc(pir_func_id);
@@ -1511,10 +1516,83 @@ namespace panther{
 			}
 		}
 
+		if(this->check_func_call_args_alias(func_call, *base_type.callOperator) == false){ return false; }
+
+		return true;
+	};
+
+
+	// a write argument cannot be (or be a member of / contain) another read or write argument of the same call
+	// 	(write params are noalias, and read params may be passed by value so they would not see the writes)
+	// 	only variables, params, and their members are checked (the target of a dereference is not known)
+	auto SemanticAnalyzer::check_func_call_args_alias(const AST::FuncCall& func_call, const PIR::BaseType::Operator& call_operator) noexcept -> bool {
+		using ParamKind = AST::FuncParams::Param::Kind;
+
+		auto arg_access_paths = std::vector<std::optional<std::vector<std::string_view>>>();
+		arg_access_paths.reserve(func_call.args.size());
+		for(size_t i = 0; i < func_call.args.size(); i+=1){
+			if(call_operator.params[i].kind == ParamKind::In){
+				arg_access_paths.emplace_back(); // ephemeral, so cannot alias
+			}else{
+				arg_access_paths.emplace_back(this->get_arg_access_path(this->source.getNode(func_call.args[i])));
+			}
+		}
+
+		// if one is a prefix of the other, one is (or is a member of) the other
+		const auto paths_overlap = [](std::span<const std::string_view> lhs, std::span<const std::string_view> rhs) noexcept -> bool {
+			const size_t common_size = std::min(lhs.size(), rhs.size());
+			return std::equal(lhs.begin(), lhs.begin() + common_size, rhs.begin());
+		};
+
+		for(size_t write_index = 0; write_index < func_call.args.size(); write_index+=1){
+			if(call_operator.params[write_index].kind != ParamKind::Write){ continue; }
+			if(arg_access_paths[write_index].has_value() == false){ continue; }
+
+			for(size_t i = 0; i < func_call.args.size(); i+=1){
+				if(i == write_index || arg_access_paths[i].has_value() == false){ continue; }
+
+				// each pair of write arguments is only reported once
+				if(call_operator.params[i].kind == ParamKind::Write && i < write_index){ continue; }
+
+				if(paths_overlap(*arg_access_paths[write_index], *arg_access_paths[i])){
+					this->source.error(
+						"An argument cannot alias a write argument of the same function call", func_call.args[i],
+						std::vector<Message::Info>{
+							Message::Info(std::format("In argument: {}", i)),
+							Message::Info(std::format("Aliases write argument: {}", write_index)),
+						}
+					);
+					return false;
+				}
+			}
+		}
+
 		return true;
 	};
 
 
+	// the identifier followed by the name of each member accessed (`a.b.c` -> {"a", "b", "c"})
+	// 	nullopt if the argument is not a variable, param, or a member of one
+	auto SemanticAnalyzer::get_arg_access_path(const AST::Node& arg_node) const noexcept -> std::optional<std::vector<std::string_view>> {
+		if(arg_node.kind == AST::Kind::Ident){
+			return std::vector<std::string_view>{this->source.getIdent(arg_node).value.string};
+		}
+
+		if(arg_node.kind == AST::Kind::Infix){
+			const AST::Infix& infix = this->source.getInfix(arg_node);
+			if(this->source.getToken(infix.op).kind != Token::get(".")){ return std::nullopt; }
+
+			std::optional<std::vector<std::string_view>> access_path = this->get_arg_access_path(this->source.getNode(infix.lhs));
+			if(access_path.has_value() == false){ return std::nullopt; }
+
+			access_path->emplace_back(this->source.getIdent(infix.rhs).value.string);
+			return access_path;
+		}
+
+		return std::nullopt;
+	};
+
+
 	auto SemanticAnalyzer::get_func_call_args(const AST::FuncCall& func_call, ScopeManager& scope_manager) noexcept -> evo::Result<std::vector<PIR::Expr>> {
 		auto args = std::vector<PIR::Expr>();
 
@@ -1646,6 +1724,7 @@ namespace panther{
 					if(rhs_info.value().expr->kind == PIR::Expr::Kind::Param){
 						PIR::Param& param = this->source.getParam(rhs_info.value().expr->param);
 						param.mayHaveBeenEdited = true;
+						param.isAddressTaken = true;
 
 					}else if(rhs_info.value().expr->kind == PIR::Expr::Kind::Accessor){
 						PIR::Accessor& accessor = this->source.getAccessor(rhs_info.value().expr->accessor);
@@ -1659,6 +1738,7 @@ namespace panther{
 						if(lhs->kind == PIR::Expr::Kind::Param){
 							PIR::Param& param = this->source.getParam(lhs->param);
 							param.mayHaveBeenEdited = true;
+							param.isAddressTaken = true;
 						}
 					}
 
@@ -2746,7 +2826,7 @@ namespace panther{
 
 
 			base_type_id = this->src_manager.getBaseTypeID(type_token.kind);
-			type_qualifiers = type.qualifiers;
+			type_qualifiers.assign(type.qualifiers.begin(), type.qualifiers.end());
 
 		}else{
 			// not builtin-type
@@ -2790,7 +2870,7 @@ namespace panther{
 							const PIR::Struct& pir_struct = this->source.getStruct(struct_data.struct_id);
 
 							base_type_id = pir_struct.baseType;
-							type_qualifiers = type.qualifiers;
+							type_qualifiers.assign(type.qualifiers.begin(), type.qualifiers.end());
 
 						}else if(scope.template_args.contains(ident)){
 							const PIR::TemplateArg& template_arg = scope.template_args.at(ident);
@@ -2854,12 +2934,11 @@ namespace panther{
 							type_qualifiers.push_back(qualifier);
 						}
 
-					}else if(import_source.pir.pub_structs.contains(rhs_ident.value.string)){
-						const PIR::Struct::ID struct_id = import_source.pir.pub_structs.at(rhs_ident.value.string);
-						const PIR::Struct& struct_info = struct_id.source.getStruct(struct_id);
+					}else if(const std::optional<PIR::Struct::ID> struct_id = import_source.getPublicStruct(rhs_ident.value.string)){
+						const PIR::Struct& struct_info = struct_id->source.getStruct(*struct_id);
 
 						base_type_id = struct_info.baseType;
-						type_qualifiers = type.qualifiers;
+						type_qualifiers.assign(type.qualifiers.begin(), type.qualifiers.end());
 
 					}
 
@@ -2889,7 +2968,7 @@ namespace panther{
 						const Token& ident_tok = this->source.getToken(ident_tok_id);
 						ident = ident_tok.value.string;
 
-						type_qualifiers = type.qualifiers;
+						type_qualifiers.assign(type.qualifiers.begin(), type.qualifiers.end());
 
 						for(size_t scope_index : scope_manager.get_scopes()){
 							ScopeManager::Scope* scope = &this->scope_alloc[scope_index];
@@ -3170,7 +3249,7 @@ namespace panther{
 
 			if(scope.vars.contains(ident_str)){
 				const PIR::Var& var = this->source.getVar(scope.vars.at(ident_str));
-				const Location location = this->source.getToken(var.ident).location;
+				const Location location = this->source.getTokenLocation(var.ident);
 
 				this->source.error(
 					std::format("Identifier \"{}\" already defined", ident.value.string), ident,
@@ -3192,10 +3271,10 @@ namespace panther{
 				const ScopeManager::Scope::StructData& struct_data = scope.structs.at(ident_str);
 				const Location location = [&]() noexcept {
 					if(struct_data.is_template){
-						return this->source.getIdent(struct_data.template_info.ast_struct->ident).location;
+						return this->source.getTokenLocation(this->source.getIdent(struct_data.template_info.ast_struct->ident));
 					}else{
 						const PIR::Struct& struct_decl = this->source.getStruct(struct_data.struct_id);
-						return this->source.getToken(struct_decl.ident).location;
+						return this->source.getTokenLocation(struct_decl.ident);
 					}
 				}();
 
@@ -3208,7 +3287,7 @@ namespace panther{
 
 			if(scope.params.contains(ident_str)){
 				const PIR::Param& param = this->source.getParam(scope.params.at(ident_str));
-				const Location location = this->source.getToken(param.ident).location;
+				const Location location = this->source.getTokenLocation(param.ident);
 
 				this->source.error(
 					std::format("Identifier \"{}\" already defined", ident.value.string), ident,
@@ -3219,7 +3298,7 @@ namespace panther{
 
 			if(scope.imports.contains(ident_str)){
 				const ScopeManager::Import& import = scope.imports.at(ident_str);
-				const Location location = this->source.getIdent(import.ident).location;
+				const Location location = this->source.getTokenLocation(this->source.getIdent(import.ident));
 
 				this->source.error(
 					std::format("Identifier \"{}\" already defined", ident.value.string), ident,
@@ -3230,7 +3309,7 @@ namespace panther{
 
 			if(scope.aliases.contains(ident_str)){
 				const ScopeManager::Alias& alias = scope.aliases.at(ident_str);
-				const Location location = this->source.getIdent(alias.ident).location;
+				const Location location = this->source.getTokenLocation(this->source.getIdent(alias.ident));
 
 				this->source.error(
 					std::format("Identifier \"{}\" already defined", ident.value.string), ident,
@@ -3241,7 +3320,7 @@ namespace panther{
 
 			if(scope.template_args.contains(ident_str)){
 				// const PIR::TemplateArg& template_arg = scope.template_args.at(ident_str);
-				// const Location location = this->source.getIdent(alias.ident).location;
+				// const Location location = this->source.getTokenLocation(this->source.getIdent(alias.ident));
 
 				this->source.error(
 					std::format("Identifier \"{}\" already defined", ident.value.string), ident,
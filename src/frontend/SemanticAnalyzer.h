@@ -58,6 +58,8 @@ namespace panther{
 
 			EVO_NODISCARD auto check_func_call(const AST::FuncCall& func_call, PIR::Type::ID func_type_id, ScopeManager& scope_manager) noexcept -> bool;
 			EVO_NODISCARD auto get_func_call_args(const AST::FuncCall& func_call, ScopeManager& scope_manager) noexcept -> evo::Result<std::vector<PIR::Expr>>;
+			EVO_NODISCARD auto check_func_call_args_alias(const AST::FuncCall& func_call, const PIR::BaseType::Operator& call_operator) noexcept -> bool;
+			EVO_NODISCARD auto get_arg_access_path(const AST::Node& arg_node) const noexcept -> std::optional<std::vector<std::string_view>>;
 
 
 
@@ -5,23 +5,129 @@
 #include "./Parser.h"
 #include "./SemanticAnalyzer.h"
 #include "frontend/SourceManager.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <limits>
 
 namespace panther{
 
+	// the path of the source is the detail of its trace spans
+	static auto get_trace_detail(const Source& source) noexcept {
+		return [&source]() noexcept -> std::string { return source.getLocation().string(); };
+	};
+
 
 	auto Source::tokenize() noexcept -> bool {
+		if(this->has_set_tokens_and_ast){ return true; }
+
+		const auto trace_span = Trace::Span("Source::tokenize", get_trace_detail(*this));
+
+		// offsets into the source are stored as uint32_t
+		if(this->getData().size() > std::numeric_limits<uint32_t>::max()){
+			this->line_starts = {0};
+			this->error(
+				std::format("Source file is too large (max size is {} bytes)", std::numeric_limits<uint32_t>::max()),
+				Location{1, 1, 1, 1}
+			);
+			return false;
+		}
+
+		this->line_starts = CharStream::get_line_starts(this->getData());
+
 		auto tokenizer = Tokenizer(*this);
 		return tokenizer.tokenize();
 	};
 
 
 	auto Source::parse() noexcept -> bool {
+		if(this->has_set_tokens_and_ast){ return true; }
+
+		const auto trace_span = Trace::Span("Source::parse", get_trace_detail(*this));
+
 		auto parser = Parser(*this);
 		return parser.parse();
 	};
 
 
+
+	auto Source::extractTokensAndAST() noexcept -> TokensAndAST {
+		evo::debugAssert(this->line_starts.empty() == false, "Source was not tokenized");
+
+		auto string_literal_values_list = std::vector<std::unique_ptr<std::string>>();
+		string_literal_values_list.reserve(this->string_literal_values.size());
+		for(std::string* str_ptr : this->string_literal_values){
+			string_literal_values_list.emplace_back(str_ptr);
+		}
+		this->string_literal_values.clear();
+
+		return TokensAndAST{
+			.lineStarts          = std::move(this->line_starts),
+			.tokens              = std::move(this->tokens),
+			.tokenPayloads       = std::move(this->token_payloads),
+			.stringLiteralValues = std::move(string_literal_values_list),
+			.globalStmts         = std::move(this->global_stmts),
+			.nodes               = std::move(this->nodes),
+			.varDecls            = std::move(this->var_decls),
+			.funcs               = std::move(this->funcs),
+			.structs             = std::move(this->structs),
+			.templatePacks       = std::move(this->template_packs),
+			.funcParams          = std::move(this->func_params),
+			.conditionals        = std::move(this->conditionals),
+			.aliases             = std::move(this->aliases),
+			.returns             = std::move(this->returns),
+			.prefixes            = std::move(this->prefixes),
+			.infixes             = std::move(this->infixes),
+			.postfixes           = std::move(this->postfixes),
+			.templatedExprs      = std::move(this->templated_exprs),
+			.funcCalls           = std::move(this->func_calls),
+			.initializers        = std::move(this->initializers),
+			.types               = std::move(this->types),
+			.blocks              = std::move(this->blocks),
+			.astArena            = std::move(this->ast_arena),
+		};
+	};
+
+
+	auto Source::setTokensAndAST(TokensAndAST&& tokens_and_ast) noexcept -> void {
+		evo::debugAssert(this->line_starts.empty(), "Source was already tokenized");
+
+		this->line_starts     = std::move(tokens_and_ast.lineStarts);
+		this->tokens          = std::move(tokens_and_ast.tokens);
+		this->token_payloads  = std::move(tokens_and_ast.tokenPayloads);
+
+		this->string_literal_values.reserve(tokens_and_ast.stringLiteralValues.size());
+		for(std::unique_ptr<std::string>& str_ptr : tokens_and_ast.stringLiteralValues){
+			this->string_literal_values.emplace_back(str_ptr.release());
+		}
+
+		this->global_stmts    = std::move(tokens_and_ast.globalStmts);
+		this->nodes           = std::move(tokens_and_ast.nodes);
+		this->var_decls       = std::move(tokens_and_ast.varDecls);
+		this->funcs           = std::move(tokens_and_ast.funcs);
+		this->structs         = std::move(tokens_and_ast.structs);
+		this->template_packs  = std::move(tokens_and_ast.templatePacks);
+		this->func_params     = std::move(tokens_and_ast.funcParams);
+		this->conditionals    = std::move(tokens_and_ast.conditionals);
+		this->aliases         = std::move(tokens_and_ast.aliases);
+		this->returns         = std::move(tokens_and_ast.returns);
+		this->prefixes        = std::move(tokens_and_ast.prefixes);
+		this->infixes         = std::move(tokens_and_ast.infixes);
+		this->postfixes       = std::move(tokens_and_ast.postfixes);
+		this->templated_exprs = std::move(tokens_and_ast.templatedExprs);
+		this->func_calls      = std::move(tokens_and_ast.funcCalls);
+		this->initializers    = std::move(tokens_and_ast.initializers);
+		this->types           = std::move(tokens_and_ast.types);
+		this->blocks          = std::move(tokens_and_ast.blocks);
+		this->ast_arena       = std::move(tokens_and_ast.astArena);
+
+		this->has_set_tokens_and_ast = true;
+	};
+
+
 	auto Source::semantic_analysis_global_idents_and_imports() noexcept -> bool {
+		const auto trace_span = Trace::Span("Source::semantic_analysis_global_idents_and_imports", get_trace_detail(*this));
+
 		this->semantic_analyzer = new SemanticAnalyzer(*this);
 		
 		return this->semantic_analyzer->semantic_analysis_global_idents_and_imports();
@@ -29,19 +135,27 @@ namespace panther{
 
 	
 	auto Source::semantic_analysis_global_aliases() noexcept -> bool {
+		const auto trace_span = Trace::Span("Source::semantic_analysis_global_aliases", get_trace_detail(*this));
+
 		return this->semantic_analyzer->semantic_analysis_global_aliases();
 	};
 	
 
 	auto Source::semantic_analysis_global_types() noexcept -> bool {
+		const auto trace_span = Trace::Span("Source::semantic_analysis_global_types", get_trace_detail(*this));
+
 		return this->semantic_analyzer->semantic_analysis_global_types();
 	};
 	
 	auto Source::semantic_analysis_global_values() noexcept -> bool {
+		const auto trace_span = Trace::Span("Source::semantic_analysis_global_values", get_trace_detail(*this));
+
 		return this->semantic_analyzer->semantic_analysis_global_values();
 	};
 	
 	auto Source::semantic_analysis_runtime() noexcept -> bool {
+		const auto trace_span = Trace::Span("Source::semantic_analysis_runtime", get_trace_detail(*this));
+
 		const bool result = this->semantic_analyzer->semantic_analysis_runtime();
 
 		delete this->semantic_analyzer;
@@ -59,8 +173,64 @@ namespace panther{
 	auto Source::getNode(AST::Node::ID node_id) const noexcept -> const AST::Node& {
 		return this->nodes[node_id.id];
 	};
-	auto Source::getToken(Token::ID token_id) const noexcept -> const Token& {
-		return this->tokens[token_id.id];
+	auto Source::getToken(Token::ID token_id) const noexcept -> Token {
+		const Token::Packed& packed_token = this->tokens[token_id.id];
+		const Token::Kind kind = packed_token.getKind();
+
+		switch(kind){
+			case Token::Ident: {
+				const uint32_t length = packed_token.getExtra();
+				return Token(kind, packed_token.offset, length, this->getData().substr(packed_token.offset, length));
+			} break;
+
+			case Token::Intrinsic: case Token::Attribute: {
+				// the value doesn't include the '@' / '#'
+				const uint32_t length = packed_token.getExtra();
+				return Token(kind, packed_token.offset, length, this->getData().substr(packed_token.offset + 1, length - 1));
+			} break;
+
+			case Token::LiteralBool: {
+				const bool value = packed_token.getExtra() != 0;
+				const uint32_t length = value ? 4 : 5; // "true" / "false"
+				return Token(kind, packed_token.offset, length, value);
+			} break;
+
+			case Token::LiteralInt: case Token::LiteralFloat: case Token::LiteralChar: case Token::LiteralString: {
+				const Token::Payload& payload = this->token_payloads[packed_token.getExtra()];
+
+				auto token = Token(kind, packed_token.offset, payload.length);
+				token.value = payload.value;
+				return token;
+			} break;
+
+			default: {
+				return Token(kind, packed_token.offset, packed_token.getExtra());
+			} break;
+		};
+	};
+
+
+	auto Source::getTokenLocation(Token::ID token_id) const noexcept -> Location {
+		return this->getTokenLocation(this->getToken(token_id));
+	};
+
+	auto Source::getTokenLocation(const Token& token) const noexcept -> Location {
+		const LineAndCollumn start = this->get_line_and_collumn(token.offset);
+		const LineAndCollumn end = this->get_line_and_collumn(token.offset + token.length);
+
+		return Location(start.line, end.line, start.collumn, end.collumn - 1);
+	};
+
+	auto Source::getOffsetLocation(uint32_t offset) const noexcept -> Location {
+		const LineAndCollumn line_and_collumn = this->get_line_and_collumn(offset);
+
+		return Location(line_and_collumn.line, line_and_collumn.line, line_and_collumn.collumn, line_and_collumn.collumn);
+	};
+
+	auto Source::getLineOffset(uint32_t line) const noexcept -> uint32_t {
+		evo::debugAssert(line >= 1 && line <= this->line_starts.size(), "Line is out of bounds of the source");
+
+		return this->line_starts[line - 1];
 	};
 
 
@@ -201,43 +371,43 @@ namespace panther{
 	};
 
 
-	auto Source::getLiteral(AST::Node::ID node_id) const noexcept -> const Token& {
+	auto Source::getLiteral(AST::Node::ID node_id) const noexcept -> Token {
 		return this->getLiteral(this->getNode(node_id));
 	};
-	auto Source::getLiteral(const AST::Node& node) const noexcept -> const Token& {
+	auto Source::getLiteral(const AST::Node& node) const noexcept -> Token {
 		evo::debugAssert(node.kind == AST::Kind::Literal, "Node is not a Literal");
 		return this->getToken(node.token);
 	};
 
-	auto Source::getIdent(AST::Node::ID node_id) const noexcept -> const Token& {
+	auto Source::getIdent(AST::Node::ID node_id) const noexcept -> Token {
 		return this->getIdent(this->getNode(node_id));
 	};
-	auto Source::getIdent(const AST::Node& node) const noexcept -> const Token& {
+	auto Source::getIdent(const AST::Node& node) const noexcept -> Token {
 		evo::debugAssert(node.kind == AST::Kind::Ident, "Node is not a Ident");
 		return this->getToken(node.token);
 	};
 
-	auto Source::getIntrinsic(AST::Node::ID node_id) const noexcept -> const Token& {
+	auto Source::getIntrinsic(AST::Node::ID node_id) const noexcept -> Token {
 		return this->getIntrinsic(this->getNode(node_id));
 	};
-	auto Source::getIntrinsic(const AST::Node& node) const noexcept -> const Token& {
+	auto Source::getIntrinsic(const AST::Node& node) const noexcept -> Token {
 		evo::debugAssert(node.kind == AST::Kind::Intrinsic, "Node is not a Intrinsic");
 		return this->getToken(node.token);
 	};
 
 
-	auto Source::getUninit(AST::Node::ID node_id) const noexcept -> const Token& {
+	auto Source::getUninit(AST::Node::ID node_id) const noexcept -> Token {
 		return this->getUninit(this->getNode(node_id));
 	};
-	auto Source::getUninit(const AST::Node& node) const noexcept -> const Token& {
+	auto Source::getUninit(const AST::Node& node) const noexcept -> Token {
 		evo::debugAssert(node.kind == AST::Kind::Uninit, "Node is not a Uninit");
 		return this->getToken(node.token);
 	};
 
-	auto Source::getUnreachable(AST::Node::ID node_id) const noexcept -> const Token& {
+	auto Source::getUnreachable(AST::Node::ID node_id) const noexcept -> Token {
 		return this->getUnreachable(this->getNode(node_id));
 	};
-	auto Source::getUnreachable(const AST::Node& node) const noexcept -> const Token& {
+	auto Source::getUnreachable(const AST::Node& node) const noexcept -> Token {
 		evo::debugAssert(node.kind == AST::Kind::Unreachable, "Node is not a Unreachable");
 		return this->getToken(node.token);
 	};
@@ -287,17 +457,32 @@ namespace panther{
 
 
 
+	auto Source::fatal(const std::string& msg, Location location) noexcept -> void {
+		this->has_errored = true;
+
+		auto message = Message{
+			.type     = Message::Type::Fatal,
+			.source   = this,
+			.message  = msg,
+			.location = location,
+		};
+
+		this->source_manager.emitMessage(message);
+	};
+
+
+
+
 	auto Source::error(const std::string& msg, uint32_t line, uint32_t collumn, std::vector<Message::Info>&& infos) noexcept -> void {
 		this->error(msg, Location{line, line, collumn, collumn}, std::move(infos));
 	};
 
 	auto Source::error(const std::string& msg, Token::ID token_id, std::vector<Message::Info>&& infos) noexcept -> void {
-		const Token& token = this->getToken(token_id);
-		this->error(msg, token.location, std::move(infos));
+		this->error(msg, this->getTokenLocation(token_id), std::move(infos));
 	};
 
 	auto Source::error(const std::string& msg, const Token& token, std::vector<Message::Info>&& infos) noexcept -> void {
-		this->error(msg, token.location, std::move(infos));
+		this->error(msg, this->getTokenLocation(token), std::move(infos));
 	};
 
 	auto Source::error(const std::string& msg, AST::Node::ID node_id, std::vector<Message::Info>&& infos) noexcept -> void {
@@ -332,12 +517,11 @@ namespace panther{
 	};
 
 	auto Source::warning(const std::string& msg, Token::ID token_id, std::vector<Message::Info>&& infos) noexcept -> void {
-		const Token& token = this->getToken(token_id);
-		this->warning(msg, token.location, std::move(infos));
+		this->warning(msg, this->getTokenLocation(token_id), std::move(infos));
 	};
 
 	auto Source::warning(const std::string& msg, const Token& token, std::vector<Message::Info>&& infos) noexcept -> void {
-		this->warning(msg, token.location, std::move(infos));
+		this->warning(msg, this->getTokenLocation(token), std::move(infos));
 	};
 
 	auto Source::warning(const std::string& msg, AST::Node::ID node_id, std::vector<Message::Info>&& infos) noexcept -> void {
@@ -385,7 +569,7 @@ namespace panther{
 
 			case AST::Kind::TemplatePack: {
 				const AST::TemplatePack& template_pack = this->getTemplatePack(node);
-				return this->getToken(template_pack.startTok).location;
+				return this->getTokenLocation(template_pack.startTok);
 			} break;
 
 			case AST::Kind::TemplatedExpr: {
@@ -395,7 +579,7 @@ namespace panther{
 
 			case AST::Kind::FuncParams: {
 				const AST::FuncParams& func_params_block = this->getFuncParams(node);
-				return this->getToken(func_params_block.startTok).location;
+				return this->getTokenLocation(func_params_block.startTok);
 			} break;
 
 			case AST::Kind::Func: {
@@ -411,13 +595,13 @@ namespace panther{
 			case AST::Kind::Return: {
 				const AST::Return& return_stmt = this->getReturn(node);
 				const Token& token = this->getToken(return_stmt.keyword);
-				return token.location;
+				return this->getTokenLocation(token);
 			} break;
 
 			case AST::Kind::Conditional: {
 				const AST::Conditional& conditional = this->getConditional(node);
 				const Token& token = this->getToken(conditional.ifTok);
-				return token.location;
+				return this->getTokenLocation(token);
 			} break;
 			
 			case AST::Kind::Alias: {
@@ -431,7 +615,7 @@ namespace panther{
 				const AST::Type& type = this->getType(node);
 				if(type.isBuiltin){
 					const Token& token = this->getToken(type.base.token);
-					return token.location;
+					return this->getTokenLocation(token);
 				}else{
 					return this->get_node_location(this->getNode(type.base.node));
 				}
@@ -444,7 +628,7 @@ namespace panther{
 			case AST::Kind::Prefix: {
 				const AST::Prefix& prefix = this->getPrefix(node);
 				const Token& op_token = this->getToken(prefix.op);
-				return op_token.location;
+				return this->getTokenLocation(op_token);
 			} break;
 
 			case AST::Kind::Infix: {
@@ -454,7 +638,7 @@ namespace panther{
 				if(op_token.kind == Token::get(".")){
 					return this->get_node_location(infix.rhs);
 				}else{
-					return op_token.location;
+					return this->getTokenLocation(op_token);
 				}
 
 			} break;
@@ -462,7 +646,7 @@ namespace panther{
 			case AST::Kind::Postfix: {
 				const AST::Postfix& postfix = this->getPostfix(node);
 				const Token& op_token = this->getToken(postfix.op);
-				return op_token.location;
+				return this->getTokenLocation(op_token);
 			} break;
 
 			case AST::Kind::FuncCall: {
@@ -479,27 +663,27 @@ namespace panther{
 
 			case AST::Kind::Ident: {
 				const Token& token = this->getIdent(node);
-				return token.location;
+				return this->getTokenLocation(token);
 			} break;
 
 			case AST::Kind::Intrinsic: {
 				const Token& token = this->getIntrinsic(node);
-				return token.location;
+				return this->getTokenLocation(token);
 			} break;
 
 			case AST::Kind::Literal: {
 				const Token& token = this->getLiteral(node);
-				return token.location;
+				return this->getTokenLocation(token);
 			} break;
 
 			case AST::Kind::Uninit: {
 				const Token& token = this->getUninit(node);
-				return token.location;
+				return this->getTokenLocation(token);
 			} break;
 
 			case AST::Kind::Unreachable: {
 				const Token& token = this->getUnreachable(node);
-				return token.location;
+				return this->getTokenLocation(token);
 			} break;
 
 		};
@@ -508,5 +692,16 @@ namespace panther{
 	};
 
 
+	auto Source::get_line_and_collumn(uint32_t offset) const noexcept -> LineAndCollumn {
+		evo::debugAssert(this->line_starts.empty() == false, "Line starts were not found yet (source not tokenized)");
+
+		// first line that starts after `offset`
+		const auto next_line_start = std::ranges::upper_bound(this->line_starts, offset);
+		const uint32_t line = uint32_t(next_line_start - this->line_starts.begin());
+
+		return LineAndCollumn(line, offset - this->line_starts[line - 1] + 1);
+	};
+
+
 	
 };
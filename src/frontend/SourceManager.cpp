@@ -1,21 +1,78 @@
 #include "frontend/SourceManager.h"
 
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 
 namespace panther{
 
 
-	auto SourceManager::addSource(std::filesystem::path&& location, std::string&& data, const Source::Config& src_config) noexcept -> Source::ID {
-		evo::debugAssert(this->isLocked() == false, "Can only add sources to SourceManager when it is locked");
+	auto SourceManager::lock() noexcept -> void {
+		evo::debugAssert(this->is_locked == false, "SourceManager is already locked");
+
+		this->sources.reserve(this->pending_sources.size());
+		for(std::optional<Source>& pending_source : this->pending_sources){
+			evo::debugAssert(pending_source.has_value(), "Source ID was reserved but the source was never added");
+			this->sources.emplace_back(std::move(*pending_source));
+		}
+		this->pending_sources.clear();
+
+		this->is_locked = true;
+	};
 
-		const auto src_id = Source::ID( uint32_t(this->sources.size()) );
 
-		this->sources.emplace_back(std::move(location), std::move(data), src_config, *this, src_id);
+	auto SourceManager::addSource(std::filesystem::path&& location, std::string&& data, const Source::Config& src_config) noexcept -> Source::ID {
+		const Source::ID src_id = this->reserveSourceIDs(1);
+		this->addSource(src_id, std::move(location), std::move(data), src_config);
+		return src_id;
+	};
 
+	auto SourceManager::addSource(std::filesystem::path&& location, MappedFile&& data, const Source::Config& src_config) noexcept -> Source::ID {
+		const Source::ID src_id = this->reserveSourceIDs(1);
+		this->addSource(src_id, std::move(location), std::move(data), src_config);
 		return src_id;
 	};
 
 
+	auto SourceManager::reserveSourceIDs(uint32_t num_sources) noexcept -> Source::ID {
+		evo::debugAssert(this->isLocked() == false, "Can only add sources to SourceManager when it is not locked");
+
+		const auto lock = std::scoped_lock(this->pending_sources_mutex);
+
+		const auto first_id = Source::ID( uint32_t(this->pending_sources.size()) );
+		this->pending_sources.resize(this->pending_sources.size() + num_sources);
+		return first_id;
+	};
+
+
+	auto SourceManager::addSource(
+		Source::ID id, std::filesystem::path&& location, std::string&& data, const Source::Config& src_config
+	) noexcept -> void {
+		evo::debugAssert(this->isLocked() == false, "Can only add sources to SourceManager when it is not locked");
+
+		const auto lock = std::scoped_lock(this->pending_sources_mutex);
+
+		evo::debugAssert(id.id < this->pending_sources.size(), "Source ID was not reserved");
+		evo::debugAssert(this->pending_sources[id.id].has_value() == false, "Source with this ID was already added");
+
+		this->pending_sources[id.id].emplace(std::move(location), std::move(data), src_config, *this, id);
+	};
+
+	auto SourceManager::addSource(
+		Source::ID id, std::filesystem::path&& location, MappedFile&& data, const Source::Config& src_config
+	) noexcept -> void {
+		evo::debugAssert(this->isLocked() == false, "Can only add sources to SourceManager when it is not locked");
+
+		const auto lock = std::scoped_lock(this->pending_sources_mutex);
+
+		evo::debugAssert(id.id < this->pending_sources.size(), "Source ID was not reserved");
+		evo::debugAssert(this->pending_sources[id.id].has_value() == false, "Source with this ID was already added");
+
+		this->pending_sources[id.id].emplace(std::move(location), std::move(data), src_config, *this, id);
+	};
+
+
 
 	//////////////////////////////////////////////////////////////////////
 	// locked
@@ -24,6 +81,11 @@ namespace panther{
 	auto SourceManager::emitMessage(const Message& msg) const noexcept -> void {
 		evo::debugAssert(this->isLocked(), "Can only emit messages when locked");
 
+		if(this->is_buffering_messages){
+			// each source is only ever worked on by a single thread at a time, so no locking is needed
+			this->message_buffers[msg.source->getID().id].emplace_back(msg);
+			return;
+		}
 
 		this->message_callback(msg);
 	};
@@ -110,74 +172,62 @@ namespace panther{
 
 
 
-	// TODO: multithreading
 	auto SourceManager::tokenize() noexcept -> evo::uint {
 		evo::debugAssert(this->isLocked(), "Can only tokenize when locked");
 
-		evo::uint total_fails = 0;
-
-		for(Source& source : this->sources){
-			if(source.tokenize() == false){
-				total_fails += 1;
-			}
-		}
-
-
-		return total_fails;
+		return this->run_on_sources(&Source::tokenize);
 	};
 
 
-	// TODO: multithreading
 	auto SourceManager::parse() noexcept -> evo::uint {
 		evo::debugAssert(this->isLocked(), "Can only parse when locked");
 
-		evo::uint total_fails = 0;
-
-		for(Source& source : this->sources){
-			if(source.parse() == false){
-				total_fails += 1;
-			}
-		}
-
-
-		return total_fails;
+		return this->run_on_sources(&Source::parse);
 	};
 
 
 	auto SourceManager::initBuiltinTypes() noexcept -> void {
 		evo::debugAssert(this->isLocked(), "Can only initialize builtin types when locked");
 
+		auto add_builtin_type = [&](PIR::BaseType&& base_type) noexcept -> void {
+			const auto base_type_id = PIR::BaseType::ID(uint32_t(this->base_types.size()));
+
+			if(base_type.kind == PIR::BaseType::Kind::Builtin){
+				const Token::Kind tok_kind = std::get<PIR::BaseType::BuiltinData>(base_type.data).kind;
+				this->builtin_base_types[size_t(tok_kind) - size_t(Token::TypeVoid)] = base_type_id;
+			}
+
+			this->base_type_lookup.emplace(std::hash<PIR::BaseType>{}(base_type), base_type_id);
+			this->base_types.emplace_back(std::move(base_type));
+
+			const auto type = PIR::Type(base_type_id);
+			this->type_lookup.emplace(std::hash<PIR::Type>{}(type), PIR::Type::ID(uint32_t(this->types.size())));
+			this->types.emplace_back(type);
+		};
+
 		// Import (0)
-		this->base_types.emplace_back(PIR::BaseType::Kind::Import);
-		this->types.emplace_back( PIR::Type(PIR::BaseType::ID(0)) );
+		add_builtin_type(PIR::BaseType(PIR::BaseType::Kind::Import));
 
 		// Int (1)
-		this->base_types.emplace_back(PIR::BaseType::Kind::Builtin, Token::TypeInt);
-		this->types.emplace_back( PIR::Type(PIR::BaseType::ID(1)) );
+		add_builtin_type(PIR::BaseType(PIR::BaseType::Kind::Builtin, Token::TypeInt));
 
 		// UInt (2)
-		this->base_types.emplace_back(PIR::BaseType::Kind::Builtin, Token::TypeUInt);
-		this->types.emplace_back( PIR::Type(PIR::BaseType::ID(2)) );
+		add_builtin_type(PIR::BaseType(PIR::BaseType::Kind::Builtin, Token::TypeUInt));
 
 		// Bool (3)
-		this->base_types.emplace_back(PIR::BaseType::Kind::Builtin, Token::TypeBool);
-		this->types.emplace_back( PIR::Type(PIR::BaseType::ID(3)) );
+		add_builtin_type(PIR::BaseType(PIR::BaseType::Kind::Builtin, Token::TypeBool));
 
 		// String (4)
-		this->base_types.emplace_back(PIR::BaseType::Kind::Builtin, Token::TypeString);
-		this->types.emplace_back( PIR::Type(PIR::BaseType::ID(4)) );
+		add_builtin_type(PIR::BaseType(PIR::BaseType::Kind::Builtin, Token::TypeString));
 
 		// ISize (5)
-		this->base_types.emplace_back(PIR::BaseType::Kind::Builtin, Token::TypeISize);
-		this->types.emplace_back( PIR::Type(PIR::BaseType::ID(5)) );
+		add_builtin_type(PIR::BaseType(PIR::BaseType::Kind::Builtin, Token::TypeISize));
 
 		// USize (6)
-		this->base_types.emplace_back(PIR::BaseType::Kind::Builtin, Token::TypeUSize);
-		this->types.emplace_back( PIR::Type(PIR::BaseType::ID(6)) );
+		add_builtin_type(PIR::BaseType(PIR::BaseType::Kind::Builtin, Token::TypeUSize));
 	};
 
 
-	// TODO: optimize base types
 	auto SourceManager::initIntrinsics() noexcept -> void {
 		evo::debugAssert(this->isLocked(), "Can only initialize intrinsics when locked");
 		using ParamKind = AST::FuncParams::Param::Kind;
@@ -594,54 +644,143 @@ namespace panther{
 
 
 
-	// TODO: multithreading
 	auto SourceManager::semanticAnalysis() noexcept -> evo::uint {
+		for(
+			SemanticAnalysisPhase phase : {
+				SemanticAnalysisPhase::GlobalIdentsAndImports,
+				SemanticAnalysisPhase::GlobalAliases,
+				SemanticAnalysisPhase::GlobalTypes,
+				SemanticAnalysisPhase::GlobalValues,
+				SemanticAnalysisPhase::Runtime,
+			}
+		){
+			const evo::uint total_fails = this->semanticAnalysis(phase);
+			if(total_fails != 0){ return total_fails; }
+		}
+
+		return 0;
+	};
+
+
+	auto SourceManager::semanticAnalysis(SemanticAnalysisPhase phase) noexcept -> evo::uint {
 		evo::debugAssert(this->isLocked(), "Can only do semantic analysis when locked");
 
+		// The global phases are run serially in source order since sources read declarations from their imports
+		// 	(public symbols, aliases, struct members) that are still being added to during the same phase.
+		// Function bodies only depend on what the global phases produced, so they can be analyzed in parallel.
+		const auto run_on_sources_serially = [&](bool(Source::*source_phase)()) noexcept -> evo::uint {
+			evo::uint total_fails = 0;
+
+			for(Source& source : this->sources){
+				if((source.*source_phase)() == false){
+					total_fails += 1;
+				}
+			}
+
+			return total_fails;
+		};
+
+		switch(phase){
+			case SemanticAnalysisPhase::GlobalIdentsAndImports:
+				return run_on_sources_serially(&Source::semantic_analysis_global_idents_and_imports);
+
+			case SemanticAnalysisPhase::GlobalAliases:
+				return run_on_sources_serially(&Source::semantic_analysis_global_aliases);
+
+			case SemanticAnalysisPhase::GlobalTypes:
+				return run_on_sources_serially(&Source::semantic_analysis_global_types);
 
-		evo::uint total_fails = 0;
+			case SemanticAnalysisPhase::GlobalValues:
+				return run_on_sources_serially(&Source::semantic_analysis_global_values);
 
+			case SemanticAnalysisPhase::Runtime:
+				return this->run_on_sources(&Source::semantic_analysis_runtime);
+
+			default: evo::debugFatalBreak("Unknown semantic analysis phase");
+		};
+	};
 
-		for(Source& source : this->sources){
-			if(source.semantic_analysis_global_idents_and_imports() == false){
-				total_fails += 1;
+
+
+	//////////////////////////////////////////////////////////////////////
+	// threading
+
+	auto SourceManager::run_on_sources(bool(Source::*phase)()) noexcept -> evo::uint {
+		const evo::uint num_threads = std::min(this->get_num_threads(), evo::uint(this->sources.size()));
+
+		if(num_threads <= 1){
+			evo::uint total_fails = 0;
+
+			for(Source& source : this->sources){
+				if((source.*phase)() == false){
+					total_fails += 1;
+				}
 			}
+
+			return total_fails;
 		}
-		if(total_fails != 0){ return total_fails; }
 
 
-		for(Source& source : this->sources){
-			if(source.semantic_analysis_global_aliases() == false){
-				total_fails += 1;
-			}
+		// largest sources first so one large source started last doesn't leave the other threads idle
+		auto schedule = std::vector<size_t>(this->sources.size());
+		for(size_t i = 0; i < schedule.size(); i+=1){
+			schedule[i] = i;
 		}
-		if(total_fails != 0){ return total_fails; }
+		std::stable_sort(schedule.begin(), schedule.end(), [&](size_t lhs, size_t rhs) noexcept -> bool {
+			return this->sources[lhs].getData().size() > this->sources[rhs].getData().size();
+		});
+
+
+		this->message_buffers.resize(this->sources.size());
+		this->is_buffering_messages = true;
 
+		auto next_schedule_index = std::atomic<size_t>(0);
+		auto total_fails = std::atomic<evo::uint>(0);
 
-		for(Source& source : this->sources){
-			if(source.semantic_analysis_global_types() == false){
-				total_fails += 1;
+		const auto worker = [&]() noexcept -> void {
+			while(true){
+				const size_t schedule_index = next_schedule_index.fetch_add(1, std::memory_order_relaxed);
+				if(schedule_index >= schedule.size()){ return; }
+
+				if((this->sources[schedule[schedule_index]].*phase)() == false){
+					total_fails.fetch_add(1, std::memory_order_relaxed);
+				}
 			}
+		};
+
+		// the calling thread is one of the workers
+		auto workers = std::vector<std::thread>();
+		workers.reserve(num_threads - 1);
+		for(evo::uint i = 0; i < num_threads - 1; i+=1){
+			workers.emplace_back(worker);
 		}
-		if(total_fails != 0){ return total_fails; }
 
+		worker();
 
-		for(Source& source : this->sources){
-			if(source.semantic_analysis_global_values() == false){
-				total_fails += 1;
-			}
+		for(std::thread& worker_thread : workers){
+			worker_thread.join();
 		}
-		if(total_fails != 0){ return total_fails; }
+
+		this->is_buffering_messages = false;
 
 
-		for(Source& source : this->sources){
-			if(source.semantic_analysis_runtime() == false){
-				total_fails += 1;
+		for(std::vector<Message>& message_buffer : this->message_buffers){
+			for(const Message& message : message_buffer){
+				this->message_callback(message);
 			}
+
+			message_buffer.clear();
 		}
 
+		return total_fails.load();
+	};
+
 
-		return total_fails;
+	auto SourceManager::get_num_threads() const noexcept -> evo::uint {
+		if(this->config.numThreads != 0){ return this->config.numThreads; }
+
+		// hardware_concurrency() is allowed to return 0 if it can't be determined
+		return std::max(evo::uint(std::thread::hardware_concurrency()), evo::uint(1));
 	};
 
 
@@ -650,66 +789,76 @@ namespace panther{
 	// objects
 
 	auto SourceManager::getOrCreateBaseType(PIR::BaseType&& base_type) noexcept -> GottenBaseTypeID {
-		for(size_t i = 0; i < this->base_types.size(); i+=1){
-			if(base_type == this->base_types[i]){
-				return GottenBaseTypeID(PIR::BaseType::ID(uint32_t(i)), false);
+		const size_t hash = std::hash<PIR::BaseType>{}(base_type);
+
+		const auto lock = std::scoped_lock(this->types_mutex);
+
+		const auto [range_begin, range_end] = this->base_type_lookup.equal_range(hash);
+		for(auto iter = range_begin; iter != range_end; ++iter){
+			if(base_type == this->base_types[iter->second.id]){
+				return GottenBaseTypeID(iter->second, false);
 			}
 		}
 
 
+		const auto base_type_id = PIR::BaseType::ID(uint32_t(this->base_types.size()));
 		this->base_types.emplace_back(std::move(base_type));
-		return GottenBaseTypeID(PIR::BaseType::ID(uint32_t(this->base_types.size() - 1)), true);
+		this->base_type_lookup.emplace(hash, base_type_id);
+		return GottenBaseTypeID(base_type_id, true);
 	};
 
 
 	auto SourceManager::getBaseType(Token::Kind tok_kind) noexcept -> PIR::BaseType& {
-		for(PIR::BaseType& base_type : this->base_types){
-			if(base_type == tok_kind){
-				return base_type;
-			}
-		}
-
-		evo::debugFatalBreak("Cannot get unknown builtin base type");
+		return this->base_types[this->getBaseTypeID(tok_kind).id];
 	};
 
 
 	auto SourceManager::getBaseTypeID(Token::Kind tok_kind) const noexcept -> PIR::BaseType::ID {
-		for(size_t i = 0; i < this->base_types.size(); i+=1){
-			const PIR::BaseType& base_type = this->base_types[i];
+		evo::debugAssert(
+			tok_kind >= Token::TypeVoid && tok_kind <= Token::TypeUSize, "Cannot get unknown builtin base type"
+		);
 
-			if(base_type == tok_kind){
-				return PIR::BaseType::ID( uint32_t(i) );
-			}
-		}
+		// no lock needed as `builtin_base_types` doesn't change after initBuiltinTypes()
+		const std::optional<PIR::BaseType::ID>& base_type_id =
+			this->builtin_base_types[size_t(tok_kind) - size_t(Token::TypeVoid)];
 
-		evo::debugFatalBreak("Cannot get unknown builtin base type");
+		evo::debugAssert(base_type_id.has_value(), "Cannot get unknown builtin base type");
+		return *base_type_id;
 	};
 
 
 
 	auto SourceManager::getOrCreateTypeID(const PIR::Type& type) noexcept -> GottenTypeID {
-		// find existing type
-		for(size_t i = 0; i < this->types.size(); i+=1){
-			const PIR::Type& type_ref = this->types[i];
+		const size_t hash = std::hash<PIR::Type>{}(type);
 
-			if(type_ref == type){
-				return GottenTypeID(PIR::Type::ID(uint32_t(i)), false);
+		const auto lock = std::scoped_lock(this->types_mutex);
+
+		// find existing type
+		const auto [range_begin, range_end] = this->type_lookup.equal_range(hash);
+		for(auto iter = range_begin; iter != range_end; ++iter){
+			if(this->types[iter->second.id] == type){
+				return GottenTypeID(iter->second, false);
 			}
 		}
 
 
 		// create new type
+		const auto type_id = PIR::Type::ID(uint32_t(this->types.size()));
 		this->types.emplace_back(type);
-		return GottenTypeID(PIR::Type::ID(uint32_t(this->types.size() - 1)), true);
+		this->type_lookup.emplace(hash, type_id);
+		return GottenTypeID(type_id, true);
 	};
 
 	auto SourceManager::getTypeID(const PIR::Type& type) const noexcept -> PIR::Type::ID {
-		// find existing type
-		for(size_t i = 0; i < this->types.size(); i+=1){
-			const PIR::Type& type_ref = this->types[i];
+		const size_t hash = std::hash<PIR::Type>{}(type);
 
-			if(type_ref == type){
-				return PIR::Type::ID( uint32_t(i) );
+		const auto lock = std::scoped_lock(this->types_mutex);
+
+		// find existing type
+		const auto [range_begin, range_end] = this->type_lookup.equal_range(hash);
+		for(auto iter = range_begin; iter != range_end; ++iter){
+			if(this->types[iter->second.id] == type){
+				return iter->second;
 			}
 		}
 
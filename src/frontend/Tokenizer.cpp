@@ -5,14 +5,15 @@
 #include <bit>
 
 #include <charconv>
+#include <array>
+#include <algorithm>
 
 namespace panther{
 
 
 	auto Tokenizer::tokenize() noexcept -> bool {
 		while(this->char_stream.eof() == false && this->source.hasErrored() == false){
-			this->line_start = this->char_stream.get_line();
-			this->collumn_start = this->char_stream.get_collumn();
+			this->token_start = this->char_stream.get_offset();
 
 			if(this->tokenize_whitespace()){ continue; }
 			if(this->tokenize_comment()){ continue; }
@@ -33,7 +34,14 @@ namespace panther{
 
 
 	auto Tokenizer::tokenize_whitespace() noexcept -> bool {
-		if(evo::isWhitespace(this->char_stream.peek())){
+		const char peeked_char = this->char_stream.peek();
+
+		if(peeked_char == ' ' || peeked_char == '\t' || peeked_char == '\n' || peeked_char == '\r'){
+			this->char_stream.skip_whitespace();
+			return true;
+		}
+
+		if(evo::isWhitespace(peeked_char)){
 			this->char_stream.skip(1);
 			return true;
 		}
@@ -50,28 +58,26 @@ namespace panther{
 			// line comment
 
 			this->char_stream.skip(2);
-
-			while(this->char_stream.eof() == false && this->char_stream.peek() != '\n' && this->char_stream.peek() != '\r'){
-				this->char_stream.skip(1);
-			};
+			this->char_stream.skip_to_line_end();
 
 			return true;
 
 		}else if(this->char_stream.peek(1) == '*'){
 			// multi-line comment
 
-			// TODO: remove and use this->line_start, etc.
-			const uint32_t comment_beginning_line = this->char_stream.get_line();
-			const uint32_t comment_beginning_collumn = this->char_stream.get_collumn();
-
 			this->char_stream.skip(2);
 
 			unsigned num_closes_needed = 1;
 			while(num_closes_needed > 0){
+				this->char_stream.skip_to_block_comment_delimiter();
+
 				if(this->char_stream.ammount_left() < 2){
+					Location comment_beginning_location = this->source.getOffsetLocation(this->token_start);
+					comment_beginning_location.collumn_end += 1;
+
 					this->source.error(
 						"Unterminated multi-line comment",
-						Location{comment_beginning_line, comment_beginning_line, comment_beginning_collumn, comment_beginning_collumn + 1},
+						comment_beginning_location,
 						std::vector<Message::Info>{{"Expected a \"*/\" before the end of the file"}}
 					);
 					return true;
@@ -99,10 +105,109 @@ namespace panther{
 
 
 
+	//////////////////////////////////////////////////////////////////////
+	// keywords
+
+	struct KeywordEntry{
+		std::string_view str;
+		Token::Kind kind = Token::Kind::None;
+	};
+
+	static constexpr auto keyword_list = std::to_array<KeywordEntry>({
+		// literals
+		{"true",  Token::Kind::LiteralBool},
+		{"false", Token::Kind::LiteralBool},
+
+		// types
+		{"Void",   Token::Kind::TypeVoid},
+		{"Int",    Token::Kind::TypeInt},
+		{"UInt",   Token::Kind::TypeUInt},
+		{"Bool",   Token::Kind::TypeBool},
+		{"String", Token::Kind::TypeString},
+		{"ISize",  Token::Kind::TypeISize},
+		{"USize",  Token::Kind::TypeUSize},
+
+		// keywords
+		{"var",    Token::Kind::KeywordVar},
+		{"def",    Token::Kind::KeywordDef},
+		{"func",   Token::Kind::KeywordFunc},
+		{"struct", Token::Kind::KeywordStruct},
+
+		{"Type", Token::Kind::KeywordType},
+
+		{"return",      Token::Kind::KeywordReturn},
+		{"unreachable", Token::Kind::KeywordUnreachable},
+		{"if",          Token::Kind::KeywordIf},
+		{"else",        Token::Kind::KeywordElse},
+
+		{"copy",   Token::Kind::KeywordCopy},
+		{"uninit", Token::Kind::KeywordUninit},
+		{"addr",   Token::Kind::KeywordAddr},
+		{"and",    Token::Kind::KeywordAnd},
+		{"or",     Token::Kind::KeywordOr},
+
+		{"read",  Token::Kind::KeywordRead},
+		{"write", Token::Kind::KeywordWrite},
+		{"in",    Token::Kind::KeywordIn},
+
+		{"alias", Token::Kind::KeywordAlias},
+
+		{"as", Token::Kind::KeywordAs},
+		// {"cast", Token::Kind::KeywordCast},
+	});
+
+
+	// Perfect hash of the keywords (from the length, first char, and last char).
+	// If a keyword is added and this static_asserts, the multipliers / table size need to be changed
+	static constexpr size_t KEYWORD_TABLE_SIZE = 64;
+
+	EVO_NODISCARD static constexpr auto keyword_hash(std::string_view str) noexcept -> size_t {
+		return (str.size() * 3 + size_t(uint8_t(str.front())) * 13 + size_t(uint8_t(str.back())) * 12) & (KEYWORD_TABLE_SIZE - 1);
+	};
+
+	EVO_NODISCARD static consteval auto keyword_hash_has_collisions() noexcept -> bool {
+		auto used = std::array<bool, KEYWORD_TABLE_SIZE>{};
+
+		for(const KeywordEntry& keyword : keyword_list){
+			const size_t hash = keyword_hash(keyword.str);
+			if(used[hash]){ return true; }
+			used[hash] = true;
+		}
+
+		return false;
+	};
+	static_assert(keyword_hash_has_collisions() == false, "Keyword hash has collisions");
+
+	static constexpr auto keyword_table = [](){
+		auto table = std::array<KeywordEntry, KEYWORD_TABLE_SIZE>{};
+
+		for(const KeywordEntry& keyword : keyword_list){
+			table[keyword_hash(keyword.str)] = keyword;
+		}
+
+		return table;
+	}();
+
+	static constexpr size_t KEYWORD_MIN_LENGTH = std::ranges::min(keyword_list, {}, [](const KeywordEntry& keyword){ return keyword.str.size(); }).str.size();
+	static constexpr size_t KEYWORD_MAX_LENGTH = std::ranges::max(keyword_list, {}, [](const KeywordEntry& keyword){ return keyword.str.size(); }).str.size();
+
+
+	// returns Token::Kind::None if not a keyword
+	EVO_NODISCARD static constexpr auto lookup_keyword(std::string_view ident_name) noexcept -> Token::Kind {
+		if(ident_name.size() < KEYWORD_MIN_LENGTH || ident_name.size() > KEYWORD_MAX_LENGTH){ return Token::Kind::None; }
+
+		const KeywordEntry& entry = keyword_table[keyword_hash(ident_name)];
+		if(entry.str != ident_name){ return Token::Kind::None; }
+
+		return entry.kind;
+	};
+
+
+
 	auto Tokenizer::tokenize_identifier() noexcept -> bool {
 		auto kind = Token::Kind::None;
 
-		char peeked_char = this->char_stream.peek();
+		const char peeked_char = this->char_stream.peek();
 		if(evo::isLetter(peeked_char) || peeked_char == '_'){
 			kind = Token::Kind::Ident;
 
@@ -125,80 +230,25 @@ namespace panther{
 
 		const char* string_start_ptr = this->char_stream.get_raw_ptr();
 
-		std::string_view::size_type token_length = 0;
-
-		do{
-			this->char_stream.skip(1);
-			token_length += 1;
-
-			if(this->char_stream.eof()){ break; }
-
-			peeked_char = this->char_stream.peek();
-		}while( (evo::isAlphaNumeric(peeked_char) || peeked_char == '_'));
+		this->char_stream.skip(1);
+		const std::string_view::size_type token_length = 1 + this->char_stream.skip_identifier_chars();
 
 		auto ident_name = std::string_view(string_start_ptr, token_length);
 
 
 
-		// TODO: hashmap
 		if(kind == Token::Kind::Ident){
-			
-			///////////////////////////////////
-			// literals
-
-			     if(ident_name == "true")  { this->create_token(Token::Kind::LiteralBool, true);  }
-			else if(ident_name == "false") { this->create_token(Token::Kind::LiteralBool, false); }
-
-
-			///////////////////////////////////
-			// types
-
-			else if(ident_name == "Void") { this->create_token(Token::Kind::TypeVoid); }
-
-			else if(ident_name == "Int")    { this->create_token(Token::Kind::TypeInt); }
-			else if(ident_name == "UInt")   { this->create_token(Token::Kind::TypeUInt); }
-			else if(ident_name == "Bool")   { this->create_token(Token::Kind::TypeBool); }
-			else if(ident_name == "String") { this->create_token(Token::Kind::TypeString); }
-
-			else if(ident_name == "ISize") { this->create_token(Token::Kind::TypeISize); }
-			else if(ident_name == "USize") { this->create_token(Token::Kind::TypeUSize); }
-
-
-			///////////////////////////////////
-			// keywords
-
-			else if(ident_name == "var")    { this->create_token(Token::Kind::KeywordVar); }
-			else if(ident_name == "def")    { this->create_token(Token::Kind::KeywordDef); }
-			else if(ident_name == "func")   { this->create_token(Token::Kind::KeywordFunc); }
-			else if(ident_name == "struct") { this->create_token(Token::Kind::KeywordStruct); }
-
-			else if(ident_name == "Type") { this->create_token(Token::Kind::KeywordType); }
-
-			else if(ident_name == "return")      { this->create_token(Token::Kind::KeywordReturn); }
-			else if(ident_name == "unreachable") { this->create_token(Token::Kind::KeywordUnreachable); }
-			else if(ident_name == "if")          { this->create_token(Token::Kind::KeywordIf); }
-			else if(ident_name == "else")        { this->create_token(Token::Kind::KeywordElse); }
-
-			else if(ident_name == "copy")   { this->create_token(Token::Kind::KeywordCopy); }
-			else if(ident_name == "uninit") { this->create_token(Token::Kind::KeywordUninit); }
-			else if(ident_name == "addr")   { this->create_token(Token::Kind::KeywordAddr); }
-			else if(ident_name == "and")    { this->create_token(Token::Kind::KeywordAnd); }
-			else if(ident_name == "or")     { this->create_token(Token::Kind::KeywordOr); }
+			const Token::Kind keyword_kind = lookup_keyword(ident_name);
 
-			else if(ident_name == "read")  { this->create_token(Token::Kind::KeywordRead); }
-			else if(ident_name == "write") { this->create_token(Token::Kind::KeywordWrite); }
-			else if(ident_name == "in")    { this->create_token(Token::Kind::KeywordIn); }
+			if(keyword_kind == Token::Kind::None){
+				this->create_token(Token::Ident, ident_name);
 
-			else if(ident_name == "alias")    { this->create_token(Token::Kind::KeywordAlias); }
+			}else if(keyword_kind == Token::Kind::LiteralBool){
+				this->create_token(Token::Kind::LiteralBool, ident_name == "true");
 
-			else if(ident_name == "as")   { this->create_token(Token::Kind::KeywordAs); }
-			// else if(ident_name == "cast") { this->create_token(Token::Kind::KeywordCast); }
-
-
-			///////////////////////////////////
-			// else
-
-			else{ this->create_token(Token::Ident, ident_name); }
+			}else{
+				this->create_token(keyword_kind);
+			}
 
 		}else{
 			this->create_token(kind, ident_name);
@@ -303,8 +353,7 @@ namespace panther{
 	auto Tokenizer::tokenize_number_literal() noexcept -> bool {
 		if(evo::isNumber(this->char_stream.peek()) == false){ return false; }
 
-		const uint32_t number_beginning_line = this->char_stream.get_line();
-		const uint32_t number_beginning_collumn = this->char_stream.get_collumn();
+		const uint32_t number_beginning = this->char_stream.get_offset();
 
 
 		int base = 10;
@@ -330,7 +379,7 @@ namespace panther{
 			}else if(evo::isNumber(second_peek)){
 				this->source.error(
 					"Leading zeros in literal numbers are not supported",
-					this->char_stream.get_line(), this->char_stream.get_collumn(),
+					this->source.getOffsetLocation(this->char_stream.get_offset()),
 					std::vector<Message::Info>{{"the literal integer prefix for base-8 is \"0o\""}}
 				);
 
@@ -360,7 +409,7 @@ namespace panther{
 				if(has_decimal_point){
 					this->source.error(
 						"Cannot have multiple decimal points in a floating-point literal",
-						this->char_stream.get_line(), this->char_stream.get_collumn()
+						this->source.getOffsetLocation(this->char_stream.get_offset())
 					);
 					return true;
 				}
@@ -368,13 +417,13 @@ namespace panther{
 				if(base == 2){
 					this->source.error(
 						"Base-2 floating-point literals are not supported",
-						number_beginning_line, number_beginning_collumn
+						this->source.getOffsetLocation(number_beginning)
 					);
 					return true;
 				}else if(base == 8){
 					this->source.error(
 						"Base-8 floating-point literals are not supported",
-						number_beginning_line, number_beginning_collumn
+						this->source.getOffsetLocation(number_beginning)
 					);
 					return true;
 				}
@@ -395,7 +444,7 @@ namespace panther{
 				}else if(evo::isHexNumber(peeked_char)){
 					this->source.error(
 						"Base-2 numbers should only have digits 0 and 1",
-						this->char_stream.get_line(), this->char_stream.get_collumn()
+						this->source.getOffsetLocation(this->char_stream.get_offset())
 					);
 					return true;
 
@@ -410,7 +459,7 @@ namespace panther{
 				}else if(evo::isHexNumber(peeked_char)){
 					this->source.error(
 						"Base-8 numbers should only have digits 0-7",
-						this->char_stream.get_line(), this->char_stream.get_collumn()
+						this->source.getOffsetLocation(this->char_stream.get_offset())
 					);
 					return true;
 
@@ -428,7 +477,7 @@ namespace panther{
 				}else if(evo::isHexNumber(peeked_char)){
 					this->source.error(
 						"Base-10 numbers should only have digits 0-9",
-						this->char_stream.get_line(), this->char_stream.get_collumn()
+						this->source.getOffsetLocation(this->char_stream.get_offset())
 					);
 					return true;
 
@@ -469,8 +518,8 @@ namespace panther{
 				}else if(evo::isHexNumber(peeked_char)){
 					this->source.error(
 						"Literal number exponents should only have digits 0-9",
-						this->char_stream.get_line(), this->char_stream.get_collumn(
-					));
+						this->source.getOffsetLocation(this->char_stream.get_offset())
+					);
 					return true;
 
 				}else{
@@ -492,14 +541,14 @@ namespace panther{
 			if(exponent_number == ULLONG_MAX && errno == ERANGE){
 				this->source.error(
 					"Literal number exponent too large to fit into a I64. This limitation will be removed when the compiler is self hosted.",
-					number_beginning_line, number_beginning_collumn
+					this->source.getOffsetLocation(number_beginning)
 				);
 				return true;
 
 			}else if(exponent_number == 0){
 				for(const char& character : exponent_string){
 					if(character != '0'){
-						this->source.fatal("Tried to parse invalid integer string for exponent", number_beginning_line, number_beginning_collumn);
+						this->source.fatal("Tried to parse invalid integer string for exponent", this->source.getOffsetLocation(number_beginning));
 						return true;
 					}
 				}
@@ -519,7 +568,7 @@ namespace panther{
 				if(floating_point_number > max_float_exp){
 					this->source.error(
 						"Literal number exponent too large to fit into an F64.",
-						number_beginning_line, number_beginning_collumn
+						this->source.getOffsetLocation(number_beginning)
 					);
 					return true;
 				}
@@ -530,7 +579,7 @@ namespace panther{
 				if(floating_point_number > max_int_exp){
 					this->source.error(
 						"Literal number exponent too large to fit into a UI64. This limitation will be removed when the compiler is self hosted.",
-						number_beginning_line, number_beginning_collumn
+						this->source.getOffsetLocation(number_beginning)
 					);
 					return true;
 				}
@@ -553,17 +602,17 @@ namespace panther{
 			if(parsed_number == HUGE_VALL){
 				this->source.error(
 					"Literal floating-point too large to fit into an F64",
-					number_beginning_line, number_beginning_collumn
+					this->source.getOffsetLocation(number_beginning)
 				);
 			}else if(parsed_number == 0.0L && str_end == number_string.data()){
-				this->source.fatal("Tried to parse invalid floating-point string", number_beginning_line, number_beginning_collumn);
+				this->source.fatal("Tried to parse invalid floating-point string", this->source.getOffsetLocation(number_beginning));
 				return true;
 			}
 
 			if(parsed_number == 0.0 && std::numeric_limits<float64_t>::max() / parsed_number < std::pow(10, exponent_number)){
 				this->source.error(
 					"Literal number exponent too large to fit into an F64. This limitation will be removed when the compiler is self hosted.",
-					number_beginning_line, number_beginning_collumn
+					this->source.getOffsetLocation(number_beginning)
 				);
 				return true;
 			}
@@ -582,14 +631,14 @@ namespace panther{
 			if(parsed_number == ULLONG_MAX && errno == ERANGE){
 				this->source.error(
 					"Literal integer too large to fit into a UI64. This limitation will be removed when the compiler is self hosted.",
-					number_beginning_line, number_beginning_collumn
+					this->source.getOffsetLocation(number_beginning)
 				);
 				return true;
 
 			}else if(parsed_number == 0){
 				for(const char& character : number_string){
 					if(character != '0'){
-						this->source.fatal("Tried to parse invalid integer string", number_beginning_line, number_beginning_collumn);
+						this->source.fatal("Tried to parse invalid integer string", this->source.getOffsetLocation(number_beginning));
 						return true;
 					}
 				}
@@ -599,7 +648,7 @@ namespace panther{
 			if(parsed_number != 0 && std::numeric_limits<uint64_t>::max() / parsed_number < std::pow(10, exponent_number)){
 				this->source.error(
 					"Literal number exponent too large to fit into a UI64. This limitation will be removed when the compiler is self hosted.",
-					number_beginning_line, number_beginning_collumn
+					this->source.getOffsetLocation(number_beginning)
 				);
 				return true;
 			}
@@ -625,12 +674,17 @@ namespace panther{
 
 		auto literal_value = std::string();
 
-		while(this->char_stream.peek() != delimiter){
+		// source data is not null-terminated, so the end has to be checked before every peek
+		while(this->char_stream.eof() || this->char_stream.peek() != delimiter){
 			bool unexpected_eof = false;
 
 			if(this->char_stream.eof()){
 				unexpected_eof = true;
 
+			}else if(this->char_stream.peek() == '\\' && this->char_stream.ammount_left() < 2){
+				this->char_stream.skip(1);
+				unexpected_eof = true;
+
 			}else if(this->char_stream.peek() == '\\'){
 				switch(this->char_stream.peek(1)){
 					break; case '0': literal_value += '\0';
@@ -649,10 +703,11 @@ namespace panther{
 					break; default: {
 						this->source.error(
 							std::format("Unknown string escape code '\\{}'", this->char_stream.peek(1)),
-							Location(
-								this->char_stream.get_line(), this->char_stream.get_line(),
-								this->char_stream.get_collumn(), this->char_stream.get_collumn() + 1
-							)
+							[&]() noexcept {
+								Location escape_code_location = this->source.getOffsetLocation(this->char_stream.get_offset());
+								escape_code_location.collumn_end += 1;
+								return escape_code_location;
+							}()
 						);
 
 						return true;
@@ -681,7 +736,7 @@ namespace panther{
 
 				this->source.error(
 					std::format("Unterminated {} literal", string_type_name),
-					this->line_start, this->collumn_start,
+					this->source.getOffsetLocation(this->token_start),
 
 					std::vector<Message::Info>{
 						Message::Info(std::format("Expected a {} before the end of the file", delimiter)),
@@ -718,17 +773,58 @@ namespace panther{
 
 
 	auto Tokenizer::create_token(Token::Kind kind) noexcept -> void {
-		this->source.tokens.emplace_back(
-			kind, Location(this->line_start, this->char_stream.get_line(), this->collumn_start, this->char_stream.get_collumn() - 1)
-		);
+		this->source.tokens.emplace_back(kind, this->token_start, this->char_stream.get_offset() - this->token_start);
 	};
 
 
 	template<typename T>
 	auto Tokenizer::create_token(Token::Kind kind, T value) noexcept -> void {
-		this->source.tokens.emplace_back(
-			kind, Location(this->line_start, this->char_stream.get_line(), this->collumn_start, this->char_stream.get_collumn() - 1), value
-		);
+		const uint32_t length = this->char_stream.get_offset() - this->token_start;
+
+		if constexpr(std::is_same_v<T, bool>){
+			this->source.tokens.emplace_back(kind, this->token_start, uint32_t(value));
+
+		}else{
+			if constexpr(std::is_same_v<T, std::string_view>){
+				// value can be gotten from the source data
+				if(kind == Token::Kind::Ident || kind == Token::Kind::Intrinsic || kind == Token::Kind::Attribute){
+					if(length > Token::Packed::MAX_EXTRA){
+						this->source.error(
+							std::format("Identifier is too long (max length is {})", Token::Packed::MAX_EXTRA),
+							this->source.getOffsetLocation(this->token_start)
+						);
+						return;
+					}
+
+					this->source.tokens.emplace_back(kind, this->token_start, length);
+					return;
+				}
+			}
+
+			if(this->source.token_payloads.size() > Token::Packed::MAX_EXTRA){
+				this->source.error(
+					std::format("Too many literals in one file (max is {})", size_t(Token::Packed::MAX_EXTRA) + 1),
+					this->source.getOffsetLocation(this->token_start)
+				);
+				return;
+			}
+
+			Token::Payload& payload = this->source.token_payloads.emplace_back();
+			payload.length = length;
+
+			if constexpr(std::is_same_v<T, std::string_view>){
+				payload.value.string = value;
+
+			}else if constexpr(std::is_same_v<T, uint64_t>){
+				payload.value.integer = value;
+
+			}else{
+				static_assert(std::is_same_v<T, float64_t>, "Unknown token value type");
+				payload.value.floatingPoint = value;
+			}
+
+			this->source.tokens.emplace_back(kind, this->token_start, uint32_t(this->source.token_payloads.size() - 1));
+		}
 	};
 
 
@@ -768,7 +864,7 @@ namespace panther{
 		if(peeked_char >= 0){
 			this->source.error(
 				std::format("Unrecognized character \"{}\" (charcode: {})", evo::printCharName(peeked_char), int(peeked_char)),
-				this->char_stream.get_line(), this->char_stream.get_collumn()
+				this->source.getOffsetLocation(this->char_stream.get_offset())
 			);
 
 		}else{
@@ -783,12 +879,19 @@ namespace panther{
 			if(num_chars_of_utf8 > 4){
 				this->source.error(
 					"Unrecognized character (non-standard utf-8 character)",
-					this->char_stream.get_line(), this->char_stream.get_collumn()
+					this->source.getOffsetLocation(this->char_stream.get_offset())
+				);
+				return;
+			}
+
+			if(this->char_stream.ammount_left() < size_t(num_chars_of_utf8)){
+				this->source.error(
+					"Unrecognized character (incomplete utf-8 character at the end of the file)",
+					this->source.getOffsetLocation(this->char_stream.get_offset())
 				);
 				return;
 			}
 
-			// TODO: make sure this is safe to do (not past EOF)
 			for(ptrdiff_t i = 0; i < num_chars_of_utf8; i+=1){
 				utf8_str.push_back(this->char_stream.peek(i));
 			}
@@ -859,7 +962,7 @@ namespace panther{
 
 			this->source.error(
 				std::format("Unrecognized character \"{}\" (UTF-8 code: {})", utf8_str, utf8_charcodes_str),
-				this->char_stream.get_line(), this->char_stream.get_collumn()
+				this->source.getOffsetLocation(this->char_stream.get_offset())
 			);
 		}
 	};
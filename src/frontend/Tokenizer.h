@@ -34,8 +34,7 @@ namespace panther{
 			Source& source;
 			CharStream char_stream;
 
-			uint32_t line_start;
-			uint32_t collumn_start;
+			uint32_t token_start; // offset in the source data
 	};
 
 